@@ -2,6 +2,10 @@
 
 #include "WifiScanner.h"
 #include "SecurityGrader.h"
+#include "IncrementalGrader.h"
+#include "NetworkTable.h"
+#include "ScanArena.h"
+#include "WeightProfile.h"
 #include <string>
 #include <vector>
 #include <memory>
@@ -11,6 +15,8 @@ namespace WifiScanner {
 class CommandProcessor {
 public:
     CommandProcessor();
+    // Scan with the given scanner instead of the platform's, e.g. a ReplayWifiScanner
+    explicit CommandProcessor(std::unique_ptr<WifiScanner> scanner);
     ~CommandProcessor() = default;
     
     // Main command processing loop
@@ -28,7 +34,11 @@ public:
 private:
     std::unique_ptr<WifiScanner> scanner_;
     SecurityGrader grader_;
-    std::vector<NetworkInfo> lastScanResults_;
+    IncrementalGrader incrementalGrader_;  // Regrades only what changed between scans
+    ProfileRegistry profiles_;
+    std::string activeProfile_;            // Profile the last scan was graded with
+    ScanBuffer lastScan_;                  // Last scan or loaded snapshot; its arena is reused by the next one
+    std::vector<ScoreBreakdown> lastScanBreakdowns_;  // Parallel to lastScan_.table()
     size_t currentPage_;
     static const size_t NETWORKS_PER_PAGE = 10;
     
@@ -39,21 +49,36 @@ private:
     bool handleVersionCommand(const std::vector<std::string>& args);
     bool handleExitCommand(const std::vector<std::string>& args);
     bool handlePageCommand(const std::vector<std::string>& args);
+    bool handleStatsCommand(const std::vector<std::string>& args);
+    bool handleProfileCommand(const std::vector<std::string>& args);
+    bool handleSummaryCommand(const std::vector<std::string>& args);
+    bool handleSaveCommand(const std::vector<std::string>& args);
+    bool handleLoadCommand(const std::vector<std::string>& args);
     
     // Utility functions
     std::vector<std::string> parseCommand(const std::string& input) const;
-    void displayNetworks(const std::vector<NetworkInfo>& networks, size_t page = 0) const;
-    void displayNetworkDetails(const NetworkInfo& network) const;
+    void displayNetworks(const NetworkTable& networks,
+                         const std::vector<ScoreBreakdown>& breakdowns, size_t page = 0) const;
+    void displayNetworks(const std::vector<CompactNetwork>& networks,
+                         const std::vector<ScoreBreakdown>& breakdowns, size_t page = 0) const;
+    void displayNetworkDetails(const NetworkInfo& network, const ScoreBreakdown& breakdown) const;
+    void displayNetworkDetails(const CompactNetwork& network, const ScoreBreakdown& breakdown) const;
     void showPageNavigation(size_t currentPage, size_t totalPages) const;
     
     // Deep scan analysis methods
-    void performSecurityAnalysis(const NetworkInfo& network) const;
+    void performSecurityAnalysis(const NetworkInfo& network, const ScoreBreakdown& breakdown) const;
     void performPerformanceAnalysis(const NetworkInfo& network) const;
     void performThreatAnalysis(const NetworkInfo& network) const;
-    void performVulnerabilityAssessment(const NetworkInfo& network) const;
+    void performVulnerabilityAssessment(const NetworkInfo& network, const ScoreBreakdown& breakdown) const;
+    
+    // Switch grading to a named profile; false if it is unknown
+    bool selectProfile(const std::string& name);
     
     // Command prompt
     static const std::string PROMPT;
+    
+    // Profile file loaded from the working directory at startup, if present
+    static const std::string PROFILE_FILE;
 };
 
 } // namespace WifiScanner
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include "NetworkBatch.h"
+#include "StringPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace WifiScanner {
+
+// Fixed-size, allocation-free form of a NetworkInfo for large scan snapshots.
+//
+// A NetworkInfo is over 200 bytes plus four heap strings; a CompactNetwork is
+// 56 bytes with no heap data, so a snapshot of 100k networks fits in 5.6 MB.
+// Free-text fields are interned: the vendor in VendorRegistry, capabilities
+// in capabilityPool(). Conversion is lossless for every network that
+// tryFromNetworkInfo() accepts; vendorId comes back filled in.
+struct CompactNetwork {
+    static constexpr size_t MAX_SSID_LENGTH = 32;  // 802.11 limit, in bytes
+
+    char ssid[MAX_SSID_LENGTH];  // Not NUL-terminated, may contain any byte
+    uint64_t bssid : 48;         // MAC address, first octet in the high byte
+    uint64_t ssidLength : 6;
+    uint64_t securityType : 3;   // SecurityType
+    uint64_t hasBssid : 1;       // 0 for networks without a BSSID string
+    uint64_t upperCaseBssid : 1; // BSSID was written with A-F instead of a-f
+    uint16_t flags;              // NetworkFlag bits
+    int8_t signalStrength;       // dBm
+    uint8_t channel;
+    uint16_t frequency;          // MHz; the band is derived from it
+    uint16_t channelWidth;       // MHz
+    uint16_t maxDataRate;        // Mbps
+    uint16_t beaconInterval;     // ms
+    uint16_t vendorId;           // VendorRegistry ID
+    uint16_t capabilitiesId;     // capabilityPool() ID
+
+    CompactNetwork();
+
+    // Fails for SSIDs over 32 bytes, BSSIDs that are not "xx:xx:xx:xx:xx:xx" in
+    // one letter case, numbers outside the field ranges, full string pools, or
+    // networks that carry radios, which have no compact field
+    static bool tryFromNetworkInfo(const NetworkInfo& network, CompactNetwork& compact);
+
+    // Same, throwing std::invalid_argument when the network does not fit
+    static CompactNetwork fromNetworkInfo(const NetworkInfo& network);
+
+    NetworkInfo toNetworkInfo() const;
+
+    std::string_view ssidView() const { return std::string_view(ssid, ssidLength); }
+    std::string bssidString() const;
+    SecurityType type() const { return static_cast<SecurityType>(securityType); }
+    bool has(NetworkFlag flag) const { return (flags & flag) != 0; }
+
+    // Interned capability strings shared by all compact networks
+    static StringPool& capabilityPool();
+};
+
+static_assert(sizeof(CompactNetwork) == 56, "CompactNetwork layout changed");
+
+inline uint32_t packNetworkFlags(const CompactNetwork& network) {
+    return network.flags;
+}
+
+} // namespace WifiScanner
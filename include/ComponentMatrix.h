@@ -0,0 +1,63 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include "SecurityGrader.h"
+#include "WeightProfile.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace WifiScanner {
+
+// Grade distribution of a corpus under one weight profile
+struct ProfileHistogram {
+    std::string profile;
+    std::array<size_t, 5> grades{};  // Networks per grade, indexed by SecurityGrade
+    uint64_t scoreSum = 0;
+    size_t networks = 0;
+
+    size_t count(SecurityGrade grade) const { return grades[static_cast<size_t>(grade)]; }
+    double meanScore() const { return networks ? static_cast<double>(scoreSum) / networks : 0.0; }
+};
+
+// The seven unweighted score components of many networks, extracted once.
+//
+// Scoring the corpus under P weight profiles is then an N x 7 by 7 x P product
+// followed by thresholding. Rows are processed in cache-sized blocks, and each
+// block is scored against every profile while it is still in L1. Grade counts
+// are accumulated as vector compare masks, so no per-network score is ever
+// stored. Scores follow ProfileEvaluator's fixed-point rules.
+class ComponentMatrix {
+public:
+    // Rows scored against all profiles before moving on (7 columns x 4 bytes x 1024 rows = 28 KiB)
+    static constexpr size_t BLOCK_ROWS = 1024;
+
+    ComponentMatrix() = default;
+    ComponentMatrix(const SecurityGrader& grader, const std::vector<NetworkInfo>& networks);
+
+    void append(const ScoreBreakdown& components);
+    void reserve(size_t count);
+    void clear();
+    size_t size() const { return encryption_.size(); }
+
+    // Grade histogram of every row under every profile, in profile order.
+    // Thresholds must be ordered as ProfileRegistry enforces.
+    std::vector<ProfileHistogram> scoreProfiles(const std::vector<WeightProfile>& profiles,
+                                                ExecutionPolicy policy = ExecutionPolicy::sequential()) const;
+
+    // Same with an explicit kernel; falls back if the CPU lacks it
+    std::vector<ProfileHistogram> scoreProfiles(const std::vector<WeightProfile>& profiles,
+                                                ExecutionPolicy policy, SimdLevel level) const;
+
+private:
+    std::vector<int32_t> encryption_;
+    std::vector<int32_t> authentication_;
+    std::vector<int32_t> channel_;
+    std::vector<int32_t> feature_;
+    std::vector<int32_t> configuration_;
+    std::vector<int32_t> vendor_;
+    std::vector<int32_t> advanced_;
+};
+
+} // namespace WifiScanner
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include "NetworkTable.h"
+#include "SecurityGrader.h"
+#include <cstdint>
+#include <vector>
+
+namespace WifiScanner {
+
+struct IncrementalUpdateStats {
+    size_t added = 0;      // BSSIDs not present in the previous scan
+    size_t changed = 0;    // BSSIDs whose scoring inputs changed
+    size_t unchanged = 0;  // BSSIDs reused without regrading
+    size_t removed = 0;    // BSSIDs that disappeared
+    bool rebuilt = false;  // Order was rebuilt with a full sort
+};
+
+// Keeps the graded, sorted result of consecutive scans up to date.
+//
+// Every BSSID keeps a fingerprint of its scoring inputs. On each update only
+// new or changed networks are regraded, and their ranking keys are removed from
+// and reinserted into the sorted key list. When most of the scan is dirty, the
+// order is rebuilt with a full radix sort instead.
+//
+// Only per-BSSID bookkeeping (fingerprint, ranking key, ScoreBreakdown) is kept
+// between scans, not copies of the networks; the sorted result is gathered from
+// the scan vector or table passed to the last update.
+//
+// The ordering is the same as SecurityGrader::gradeAndSortNetworks, except that
+// networks with identical ranking are kept in first-seen order rather than in
+// the order of the latest scan, so stable entries do not move between sweeps.
+// The tie-break field of a ranking key is the slot, and slots are handed out in
+// increasing order and never reused; compaction renumbers them without
+// changing their relative order.
+class IncrementalGrader {
+public:
+    explicit IncrementalGrader(const SecurityGrader& grader);
+    
+    // Apply a new scan result
+    IncrementalUpdateStats update(const std::vector<NetworkInfo>& networks);
+    
+    // Same, for a scan decoded straight into a table
+    IncrementalUpdateStats update(const NetworkTable& table);
+    
+    // Positions in the last scan, best first; table.select(sortedRows()) is
+    // the sorted table
+    std::vector<uint32_t> sortedRows() const;
+    
+    // Networks from the last update, best first. `networks` must be the vector
+    // that was passed to that update.
+    std::vector<NetworkInfo> sortedNetworks(const std::vector<NetworkInfo>& networks) const;
+    
+    // Same, moving the networks out of a scan vector that is no longer needed
+    std::vector<NetworkInfo> sortedNetworks(std::vector<NetworkInfo>&& networks) const;
+    
+    // Score breakdowns in the same order as sortedNetworks()
+    std::vector<ScoreBreakdown> sortedBreakdowns() const;
+    
+    size_t size() const { return liveCount_; }
+    void clear();
+    
+    // Share of dirty entries above which a full sort beats patching
+    static constexpr double REBUILD_FRACTION = 0.25;
+    
+private:
+    struct Entry {
+        uint64_t entryKey = 0;
+        uint64_t fingerprint = 0;
+        uint64_t rankingKey = 0;
+        uint64_t lastSeen = 0;   // Update generation, 0 = free slot
+        uint32_t scanIndex = 0;  // Position in the last scan
+        ScoreBreakdown breakdown;
+    };
+    
+    template <typename Networks>
+    IncrementalUpdateStats updateFrom(const Networks& networks);
+    
+    // Map key for the n-th network with a BSSID in one scan. Repeated BSSIDs (and
+    // the rare hash collision) simply become further occurrences.
+    static uint64_t entryKey(uint64_t bssidHash, size_t occurrence);
+    
+    // Open-addressing index from entry key to slot (linear probing, 0 = empty)
+    uint32_t* findIndex(uint64_t key);
+    void insertIndex(uint64_t key, uint32_t slot);
+    void eraseIndex(uint64_t key);
+    void growIndex();
+    
+    // Remove stale keys from the sorted list and merge in the regraded ones
+    void patchSortedKeys(std::vector<uint64_t>& staleKeys, const std::vector<uint32_t>& dirtySlots);
+    
+    // Close the gaps left by removed entries, keeping slot order
+    void compactSlots();
+    
+    const SecurityGrader& grader_;
+    std::vector<uint64_t> indexKeys_;
+    std::vector<uint32_t> indexSlots_;
+    size_t liveCount_ = 0;
+    std::vector<Entry> slots_;         // In first-seen order; lastSeen == 0 marks a gap
+    std::vector<uint64_t> sortedKeys_;  // Ranking keys; the index field is the slot
+    uint64_t generation_ = 0;
+};
+
+} // namespace WifiScanner
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace WifiScanner {
+
+// The read-only contents of a file, mapped with mmap where available and read
+// into memory elsewhere. Binary formats (snapshots, OUI databases) point into
+// data() for as long as the object lives, so it can be moved but not copied.
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    // Map `path`; `kind` names the file in errors ("snapshot"). Throws
+    // std::runtime_error when the file cannot be opened or read.
+    MappedFile(const std::string& path, const std::string& kind);
+
+    // Own an image built in memory instead of a file
+    explicit MappedFile(std::string&& contents);
+
+    ~MappedFile();
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return mapped_ ? region_ : buffer_.data(); }
+    size_t size() const { return mapped_ ? length_ : buffer_.size(); }
+
+private:
+    void release();
+
+    const char* region_ = nullptr;  // mmap region when mapped_
+    size_t length_ = 0;
+    bool mapped_ = false;
+    std::string buffer_;            // Contents when not mapped
+};
+
+} // namespace WifiScanner
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WifiScanner {
+
+// Boolean NetworkInfo fields packed into one word per row
+enum NetworkFlag : uint32_t {
+    FLAG_HIDDEN          = 1u << 0,
+    FLAG_ENTERPRISE      = 1u << 1,
+    FLAG_WPS             = 1u << 2,
+    FLAG_PMF             = 1u << 3,
+    FLAG_OWE             = 1u << 4,
+    FLAG_GUEST           = 1u << 5,
+    FLAG_ROGUE_AP        = 1u << 6,
+    FLAG_EVIL_TWIN       = 1u << 7,
+    FLAG_TYPO_SQUATTING  = 1u << 8,
+    FLAG_RESPONDS_PROBES = 1u << 9,
+    FLAG_ANOMALOUS       = 1u << 10
+};
+
+struct CompactNetwork;
+
+uint32_t packNetworkFlags(const NetworkInfo& network);
+
+// Set the boolean NetworkInfo fields from NetworkFlag bits
+void unpackNetworkFlags(uint32_t flags, NetworkInfo& network);
+
+// Vendor component of a network: a table load for interned vendors, string matching otherwise
+int32_t resolveVendorScore(const NetworkInfo& network);
+
+// Non-owning columnar view over the scoring inputs of many networks.
+// Every column has `size` entries; row i across all columns is one network.
+struct NetworkBatchView {
+    size_t size = 0;
+    const int32_t* securityType = nullptr;
+    const int32_t* signalStrength = nullptr;
+    const int32_t* channel = nullptr;
+    const int32_t* frequency = nullptr;
+    const int32_t* channelWidth = nullptr;
+    const int32_t* maxDataRate = nullptr;
+    const int32_t* beaconInterval = nullptr;
+    const int32_t* vendorScore = nullptr;  // Pre-resolved vendor component
+    const uint32_t* flags = nullptr;       // NetworkFlag bits
+
+    // Rows [begin, end) as a batch of their own
+    NetworkBatchView rows(size_t begin, size_t end) const {
+        NetworkBatchView slice = *this;
+        slice.size = end - begin;
+        slice.securityType += begin;
+        slice.signalStrength += begin;
+        slice.channel += begin;
+        slice.frequency += begin;
+        slice.channelWidth += begin;
+        slice.maxDataRate += begin;
+        slice.beaconInterval += begin;
+        slice.vendorScore += begin;
+        slice.flags += begin;
+        return slice;
+    }
+};
+
+// Owning structure-of-arrays copy of the scoring inputs of many networks
+class NetworkBatch {
+public:
+    NetworkBatch() = default;
+    explicit NetworkBatch(const std::vector<NetworkInfo>& networks);
+
+    void append(const NetworkInfo& network);
+    void append(const CompactNetwork& network);
+    void reserve(size_t count);
+    void clear();
+
+    size_t size() const { return securityType_.size(); }
+    bool empty() const { return securityType_.empty(); }
+
+    NetworkBatchView view() const;
+
+private:
+    std::vector<int32_t> securityType_;
+    std::vector<int32_t> signalStrength_;
+    std::vector<int32_t> channel_;
+    std::vector<int32_t> frequency_;
+    std::vector<int32_t> channelWidth_;
+    std::vector<int32_t> maxDataRate_;
+    std::vector<int32_t> beaconInterval_;
+    std::vector<int32_t> vendorScore_;
+    std::vector<uint32_t> flags_;
+};
+
+} // namespace WifiScanner
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -42,7 +43,9 @@ struct NetworkInfo {
     bool supportsOWE;    // Opportunistic Wireless Encryption
     int maxDataRate;     // Mbps
     std::string vendor;  // Router/AP vendor if detectable
+    uint16_t vendorId;   // VendorRegistry ID for vendor (0 = not interned)
     bool isGuestNetwork; // Likely guest network based on SSID patterns
+    std::string radios;  // Interfaces that saw this BSS ("wlan0,wlan1")
     
     // Advanced security analysis
     bool isRogueAP;      // Potential rogue access point
@@ -52,9 +55,9 @@ struct NetworkInfo {
     bool respondsToProbes; // Responds to all probe requests
     bool hasAnomalousBehavior; // Unusual network behavior
     
-    NetworkInfo() : signalStrength(0), channel(0), frequency(0), isHidden(false),
+    NetworkInfo() : securityType(SecurityType::UNKNOWN), signalStrength(0), channel(0), frequency(0), isHidden(false),
                     channelWidth(20), isEnterprise(false), supportsWPS(false),
-                    supportsPMF(false), supportsOWE(false), maxDataRate(0), isGuestNetwork(false),
+                    supportsPMF(false), supportsOWE(false), maxDataRate(0), vendorId(0), isGuestNetwork(false),
                     isRogueAP(false), isEvilTwin(false), isTypoSquatting(false),
                     beaconInterval(100), respondsToProbes(false), hasAnomalousBehavior(false) {}
 };
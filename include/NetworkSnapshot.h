@@ -0,0 +1,146 @@
+#pragma once
+
+#include "MappedFile.h"
+#include "NetworkTable.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+namespace WifiScanner {
+
+// On-disk layout of a scan snapshot (version 1). Integers are in the writing
+// host's byte order, recorded in the header and checked by readers. Every
+// section starts on an 8-byte boundary:
+//
+//   SnapshotHeader
+//   SnapshotColumnEntry[columnCount]   column directory
+//   column data                        rowCount fixed-size values per column
+//   string heap                        bytes referenced by SnapshotString
+//
+// Columns are the NetworkTable columns, so a mapped file is used in place.
+struct SnapshotHeader {
+    char magic[8];             // "WIFISNAP"
+    uint32_t version;
+    uint32_t byteOrder;        // BYTE_ORDER_MARK as written
+    uint64_t rowCount;
+    uint32_t columnCount;
+    uint32_t reserved;
+    uint64_t directoryOffset;
+    uint64_t heapOffset;
+    uint64_t heapSize;
+    uint64_t fileSize;
+};
+static_assert(sizeof(SnapshotHeader) == 64, "snapshot header layout changed");
+
+enum class SnapshotColumn : uint32_t {
+    SSID = 1,
+    BSSID,
+    SECURITY_TYPE,
+    SIGNAL_STRENGTH,
+    CHANNEL,
+    FREQUENCY,
+    CAPABILITIES,
+    CHANNEL_WIDTH,
+    MAX_DATA_RATE,
+    VENDOR,  // Vendor IDs are process-local, so loading re-interns this name
+    BEACON_INTERVAL,
+    FLAGS,
+    VENDOR_SCORE,
+    RADIOS   // Optional; snapshots written without it load with no radios
+};
+
+enum class SnapshotType : uint32_t {
+    INT32 = 1,
+    UINT32,
+    STRING  // SnapshotString per row
+};
+
+struct SnapshotColumnEntry {
+    SnapshotColumn column;
+    SnapshotType type;
+    uint64_t offset;  // From the start of the file
+    uint64_t size;    // In bytes
+};
+static_assert(sizeof(SnapshotColumnEntry) == 24, "snapshot directory layout changed");
+
+// A string stored in the heap
+struct SnapshotString {
+    uint32_t offset;  // From the start of the heap
+    uint32_t length;
+};
+
+// Write a table to `path` in the snapshot format; throws std::runtime_error
+void saveSnapshot(const NetworkTable& table, const std::string& path);
+
+// A snapshot file mapped read-only and used without deserializing.
+//
+// The constructor checks the header, the directory and every string reference
+// against the file size and throws std::runtime_error for anything that does
+// not fit, so the accessors need no checks. Columns point into the mapping and
+// stay valid for the lifetime of the object. Where mmap is unavailable the file
+// is read into memory instead.
+class SnapshotTable {
+public:
+    static constexpr char MAGIC[8] = {'W', 'I', 'F', 'I', 'S', 'N', 'A', 'P'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    explicit SnapshotTable(const std::string& path);
+    SnapshotTable(const SnapshotTable&) = delete;
+    SnapshotTable& operator=(const SnapshotTable&) = delete;
+
+    size_t size() const { return rows_; }
+    bool empty() const { return rows_ == 0; }
+
+    std::string_view ssid(size_t row) const { return string(ssid_, row); }
+    std::string_view bssid(size_t row) const { return string(bssid_, row); }
+    std::string_view capabilities(size_t row) const { return string(capabilities_, row); }
+    std::string_view vendor(size_t row) const { return string(vendor_, row); }
+    std::string_view radios(size_t row) const { return radios_ ? string(radios_, row) : std::string_view(); }
+
+    ColumnSpan<int32_t> securityTypes() const { return {securityType_, rows_}; }
+    ColumnSpan<int32_t> signalStrengths() const { return {signalStrength_, rows_}; }
+    ColumnSpan<int32_t> channels() const { return {channel_, rows_}; }
+    ColumnSpan<int32_t> frequencies() const { return {frequency_, rows_}; }
+    ColumnSpan<int32_t> channelWidths() const { return {channelWidth_, rows_}; }
+    ColumnSpan<int32_t> maxDataRates() const { return {maxDataRate_, rows_}; }
+    ColumnSpan<int32_t> beaconIntervals() const { return {beaconInterval_, rows_}; }
+    ColumnSpan<uint32_t> flags() const { return {flags_, rows_}; }
+    ColumnSpan<int32_t> vendorScores() const { return {vendorScore_, rows_}; }
+
+    // Scoring columns as a batch, straight from the mapping
+    NetworkBatchView view() const;
+
+    NetworkInfo networkAt(size_t row) const;
+    NetworkTable toNetworkTable(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+private:
+    std::string_view string(const SnapshotString* column, size_t row) const {
+        return std::string_view(heap_ + column[row].offset, column[row].length);
+    }
+
+    void bindColumns(const std::string& path);
+
+    MappedFile file_;
+    size_t rows_ = 0;
+    const char* heap_ = nullptr;
+
+    const SnapshotString* ssid_ = nullptr;
+    const SnapshotString* bssid_ = nullptr;
+    const int32_t* securityType_ = nullptr;
+    const int32_t* signalStrength_ = nullptr;
+    const int32_t* channel_ = nullptr;
+    const int32_t* frequency_ = nullptr;
+    const SnapshotString* capabilities_ = nullptr;
+    const int32_t* channelWidth_ = nullptr;
+    const int32_t* maxDataRate_ = nullptr;
+    const SnapshotString* vendor_ = nullptr;
+    const int32_t* beaconInterval_ = nullptr;
+    const uint32_t* flags_ = nullptr;
+    const int32_t* vendorScore_ = nullptr;
+    const SnapshotString* radios_ = nullptr;
+};
+
+} // namespace WifiScanner
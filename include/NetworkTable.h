@@ -0,0 +1,161 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include "NetworkBatch.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace WifiScanner {
+
+// Read-only run of one column; the C++17 stand-in for std::span
+template <typename T>
+class ColumnSpan {
+public:
+    ColumnSpan(const T* data, size_t size) : data_(data), size_(size) {}
+
+    const T* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const T& operator[](size_t i) const { return data_[i]; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+
+private:
+    const T* data_;
+    size_t size_;
+};
+
+// Radio band of a frequency; 6 GHz starts at 5925 MHz (channel 1 is 5955 MHz)
+enum class WifiBand {
+    OTHER,
+    BAND_2_4GHZ,
+    BAND_5GHZ,
+    BAND_6GHZ
+};
+
+struct SignalStats {
+    size_t count = 0;
+    int min = 0;      // dBm
+    int max = 0;      // dBm
+    double mean = 0.0;
+};
+
+// Structure-of-arrays container of scan results: one contiguous column per
+// NetworkInfo field, so passes that read a few fields (band filters, security
+// type counts, signal statistics) touch only those bytes. The boolean fields
+// share one NetworkFlag column, and the vendor score is resolved on append, so
+// view() hands the scoring columns to SecurityGrader without copying.
+//
+// Columns and strings draw from one memory resource. A table on a ScanArena
+// keeps every byte of a sweep in the arena, and copies of the table use the
+// default resource.
+class NetworkTable {
+public:
+    // One row, read through the columns
+    class Row {
+    public:
+        Row(const NetworkTable& table, size_t index) : table_(&table), index_(index) {}
+
+        size_t index() const { return index_; }
+        std::string_view ssid() const { return table_->ssid_[index_]; }
+        std::string_view bssid() const { return table_->bssid_[index_]; }
+        SecurityType securityType() const { return static_cast<SecurityType>(table_->securityType_[index_]); }
+        int signalStrength() const { return table_->signalStrength_[index_]; }
+        int channel() const { return table_->channel_[index_]; }
+        int frequency() const { return table_->frequency_[index_]; }
+        std::string_view capabilities() const { return table_->capabilities_[index_]; }
+        int channelWidth() const { return table_->channelWidth_[index_]; }
+        int maxDataRate() const { return table_->maxDataRate_[index_]; }
+        std::string_view vendor() const { return table_->vendor_[index_]; }
+        uint16_t vendorId() const { return table_->vendorId_[index_]; }
+        std::string_view radios() const { return table_->radios_[index_]; }
+        int beaconInterval() const { return table_->beaconInterval_[index_]; }
+        uint32_t flags() const { return table_->flags_[index_]; }
+        bool has(NetworkFlag flag) const { return (flags() & flag) != 0; }
+        int vendorScore() const { return table_->vendorScore_[index_]; }
+
+        NetworkInfo toNetworkInfo() const;
+
+    private:
+        const NetworkTable* table_;
+        size_t index_;
+    };
+
+    explicit NetworkTable(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    explicit NetworkTable(const std::vector<NetworkInfo>& networks,
+                          std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    void append(const NetworkInfo& network);
+
+    // Bulk append of a scanner backend's results
+    void append(const std::vector<NetworkInfo>& networks);
+
+    void reserve(size_t count);
+    void clear();
+
+    size_t size() const { return securityType_.size(); }
+    bool empty() const { return securityType_.empty(); }
+
+    Row row(size_t index) const { return Row(*this, index); }
+    Row operator[](size_t index) const { return row(index); }
+    std::vector<NetworkInfo> toNetworkInfos() const;
+
+    // The given rows, in the given order, on the same memory resource
+    NetworkTable select(const std::vector<uint32_t>& rows) const;
+
+    std::pmr::memory_resource* resource() const { return ssid_.get_allocator().resource(); }
+
+    // Scoring columns as a batch; valid until the table is modified
+    NetworkBatchView view() const;
+
+    // Columns, in NetworkInfo field order
+    ColumnSpan<std::pmr::string> ssids() const { return span(ssid_); }
+    ColumnSpan<std::pmr::string> bssids() const { return span(bssid_); }
+    ColumnSpan<int32_t> securityTypes() const { return span(securityType_); }
+    ColumnSpan<int32_t> signalStrengths() const { return span(signalStrength_); }
+    ColumnSpan<int32_t> channels() const { return span(channel_); }
+    ColumnSpan<int32_t> frequencies() const { return span(frequency_); }
+    ColumnSpan<std::pmr::string> capabilities() const { return span(capabilities_); }
+    ColumnSpan<int32_t> channelWidths() const { return span(channelWidth_); }
+    ColumnSpan<int32_t> maxDataRates() const { return span(maxDataRate_); }
+    ColumnSpan<std::pmr::string> vendors() const { return span(vendor_); }
+    ColumnSpan<uint16_t> vendorIds() const { return span(vendorId_); }
+    ColumnSpan<std::pmr::string> radios() const { return span(radios_); }
+    ColumnSpan<int32_t> beaconIntervals() const { return span(beaconInterval_); }
+    ColumnSpan<uint32_t> flags() const { return span(flags_); }       // NetworkFlag bits
+    ColumnSpan<int32_t> vendorScores() const { return span(vendorScore_); }
+
+    // Analytic passes over single columns
+    std::vector<uint32_t> rowsInBand(WifiBand band) const;
+    std::array<size_t, 8> countBySecurityType() const;  // Indexed by SecurityType
+    SignalStats signalStats() const;
+
+    static WifiBand bandOf(int frequency);
+
+private:
+    template <typename T>
+    static ColumnSpan<T> span(const std::pmr::vector<T>& column) { return ColumnSpan<T>(column.data(), column.size()); }
+
+    std::pmr::vector<std::pmr::string> ssid_;
+    std::pmr::vector<std::pmr::string> bssid_;
+    std::pmr::vector<int32_t> securityType_;
+    std::pmr::vector<int32_t> signalStrength_;
+    std::pmr::vector<int32_t> channel_;
+    std::pmr::vector<int32_t> frequency_;
+    std::pmr::vector<std::pmr::string> capabilities_;
+    std::pmr::vector<int32_t> channelWidth_;
+    std::pmr::vector<int32_t> maxDataRate_;
+    std::pmr::vector<std::pmr::string> vendor_;
+    std::pmr::vector<uint16_t> vendorId_;
+    std::pmr::vector<std::pmr::string> radios_;
+    std::pmr::vector<int32_t> beaconInterval_;
+    std::pmr::vector<uint32_t> flags_;
+    std::pmr::vector<int32_t> vendorScore_;  // Pre-resolved vendor component
+};
+
+} // namespace WifiScanner
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "NetworkTable.h"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace WifiScanner {
+
+// Monotonic memory resource for the results of one scan sweep.
+//
+// Allocations bump through a block that is kept between sweeps; deallocation
+// is a no-op and reset() releases everything at once. If a sweep outgrows the
+// block, the overflow comes from the heap and the next reset() grows the block
+// to that sweep's high-water mark, so steady-state sweeps never reach malloc.
+class ScanArena : public std::pmr::memory_resource {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+
+    explicit ScanArena(size_t capacity = DEFAULT_CAPACITY);
+    ScanArena(const ScanArena&) = delete;
+    ScanArena& operator=(const ScanArena&) = delete;
+
+    // Invalidates everything allocated since the last reset
+    void reset();
+
+    size_t capacity() const { return capacity_; }
+    size_t bytesUsed() const { return bytesUsed_; }                // Since the last reset
+    size_t heapAllocations() const { return upstream_.allocations; }  // Overflow chunks since the last reset
+
+private:
+    // new/delete, counting what the monotonic resource asks for
+    struct CountingUpstream : std::pmr::memory_resource {
+        size_t allocations = 0;
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    size_t capacity_;
+    size_t bytesUsed_ = 0;
+    std::unique_ptr<std::byte[]> block_;
+    CountingUpstream upstream_;
+    std::optional<std::pmr::monotonic_buffer_resource> monotonic_;
+};
+
+// The networks of one sweep, held in a NetworkTable on a ScanArena.
+// begin() drops the previous sweep in a single operation and hands out an
+// empty table; a monitor loop that reuses one buffer does no per-network
+// heap allocation once the arena has grown to its working size.
+class ScanBuffer {
+public:
+    explicit ScanBuffer(size_t capacity = ScanArena::DEFAULT_CAPACITY);
+
+    NetworkTable& begin();
+    const NetworkTable& table() const { return *table_; }
+    const ScanArena& arena() const { return arena_; }
+
+private:
+    ScanArena arena_;
+    std::optional<NetworkTable> table_;  // Destroyed before the arena is reset
+};
+
+} // namespace WifiScanner
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "NetworkTable.h"
+#include <string>
+#include <vector>
+
+namespace WifiScanner {
+
+enum class ScanMode {
+    CACHED,  // Read the BSS table the driver already holds: instant, no radio time
+    ACTIVE   // Trigger a fresh sweep and wait for it to finish
+};
+
+// What a scan should cover. A monitor loop can alternate cheap requests (a
+// cached dump, a sweep of a few busy channels) with occasional full sweeps.
+//
+// Results are limited to `frequencies` whatever the mode, so a cached request
+// for one band returns only that band's part of the driver's table.
+struct ScanRequest {
+    ScanMode mode = ScanMode::ACTIVE;
+    std::vector<int> frequencies;  // MHz; empty means every channel
+
+    static ScanRequest cached();
+    static ScanRequest full();
+
+    // Every channel of a band, active
+    static ScanRequest band(WifiBand band);
+
+    // Active sweep of the given channels. Numbers up to 196 are 2.4 or 5 GHz
+    // channel numbers; 6 GHz channels are given by frequency (e.g. 5955).
+    // Throws std::runtime_error for anything else.
+    static ScanRequest channels(const std::vector<int>& channels);
+
+    bool isTargeted() const { return !frequencies.empty(); }
+
+    // Whether a network heard on `frequency` belongs in the results
+    bool includes(int frequency) const;
+
+    // "cached", "full", "active, 3 channels"...
+    std::string describe() const;
+};
+
+} // namespace WifiScanner
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include "NetworkTable.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace WifiScanner {
+
+struct ScoreCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t insertions = 0;
+    uint64_t evictions = 0;
+    size_t size = 0;      // Occupied entries
+    size_t capacity = 0;  // Maximum entries
+};
+
+// Bounded, lock-free score cache shared safely between threads.
+//
+// Entries are keyed on a 64-bit fingerprint of every scoring input and stored
+// as single packed words in a set-associative open-addressing table. When a
+// set is full, a per-set CLOCK hand evicts the first entry whose reference bit
+// is clear, clearing bits as it passes.
+class ScoreCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+    static constexpr size_t WAYS = 8;
+
+    explicit ScoreCache(size_t capacity = DEFAULT_CAPACITY);
+    ~ScoreCache() = default;
+
+    ScoreCache(const ScoreCache&) = delete;
+    ScoreCache& operator=(const ScoreCache&) = delete;
+
+    // Returns true and fills `score` on a hit
+    bool lookup(uint64_t fingerprint, int& score);
+
+    // Insert or refresh an entry; scores must be in [0, 100]
+    void insert(uint64_t fingerprint, int score);
+
+    void clear();
+
+    ScoreCacheStats stats() const;
+    size_t capacity() const { return setCount_ * WAYS; }
+
+    // Hash of every NetworkInfo field that influences the security score
+    static uint64_t fingerprint(const NetworkInfo& network);
+
+    // Same hash for a table row
+    static uint64_t fingerprint(const NetworkTable::Row& network);
+
+private:
+    static uint64_t fingerprint(SecurityType securityType, int signalStrength, int channel, int frequency,
+                                int channelWidth, int maxDataRate, int beaconInterval, uint32_t flags,
+                                uint16_t vendorId, std::string_view vendor);
+
+    size_t setIndex(uint64_t fingerprint) const { return fingerprint & (setCount_ - 1); }
+
+    size_t setCount_;
+    std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+    std::unique_ptr<std::atomic<uint32_t>[]> hands_;
+
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> insertions_{0};
+    std::atomic<uint64_t> evictions_{0};
+};
+
+} // namespace WifiScanner
@@ -0,0 +1,250 @@
+#pragma once
+
+#include "NetworkBatch.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace WifiScanner {
+
+// Compile-time lookup tables for the security score components.
+//
+// Each component in SecurityGrader.cpp only depends on a few enums, booleans and
+// threshold classes, so every possible outcome is enumerated here once. Grading
+// then reduces to computing small indices and adding table entries. The
+// calculate*Score functions in SecurityGrader remain the reference; the unit tests
+// check every table cell against them.
+namespace ScoringTables {
+
+// Component weights of the total score
+constexpr double ENCRYPTION_WEIGHT = 0.35;
+constexpr double AUTHENTICATION_WEIGHT = 0.15;
+constexpr double CHANNEL_WEIGHT = 0.10;
+constexpr double FEATURE_WEIGHT = 0.20;
+constexpr double CONFIGURATION_WEIGHT = 0.10;
+constexpr double VENDOR_WEIGHT = 0.05;
+constexpr double ADVANCED_WEIGHT = 0.05;
+
+// ---- Input classes ----
+
+// Class boundaries. The SIMD kernels in SecurityGraderBatch.cpp compare against
+// these same constants, so a rule change here reaches every grading path.
+constexpr int BAND_2_4GHZ_START = 2400;  // MHz
+constexpr int BAND_5GHZ_START = 5000;
+
+// Lowest frequency scored as 6GHz. The radio band starts at 5925 MHz, but the
+// grading rules have always given the 6GHz bonus from 6000 MHz.
+constexpr int SIX_GHZ_SCORE_START = 6000;
+
+constexpr int WIDE_CHANNEL_WIDTH = 80;  // MHz, and anything wider
+constexpr int MEDIUM_CHANNEL_WIDTH = 40;
+constexpr int NARROW_CHANNEL_WIDTH = 20;
+
+constexpr int CONGESTED_CHANNEL_FIRST = 1;
+constexpr int CONGESTED_CHANNEL_LAST = 11;
+
+constexpr int MODERATE_SIGNAL = -70;     // dBm
+constexpr int GOOD_SIGNAL = -50;
+constexpr int VERY_STRONG_SIGNAL = -30;
+
+constexpr int FAST_RATE = 100;           // Mbps
+constexpr int GIGABIT_RATE = 1000;
+
+constexpr int NORMAL_BEACON_START = 50;  // ms
+constexpr int LONG_BEACON_ABOVE = 200;
+
+// 0 = below 2.4GHz, 1 = 2.4GHz, 2 = 5GHz, 3 = 6GHz (from SIX_GHZ_SCORE_START)
+constexpr uint32_t bandClass(int frequency) {
+    return (frequency >= BAND_2_4GHZ_START) + (frequency >= BAND_5GHZ_START) + (frequency >= SIX_GHZ_SCORE_START);
+}
+
+// 0 = other, 1 = 80MHz or wider, 2 = 40MHz, 3 = 20MHz
+constexpr uint32_t widthClass(int channelWidth) {
+    return (channelWidth >= WIDE_CHANNEL_WIDTH) * 1u + (channelWidth == MEDIUM_CHANNEL_WIDTH) * 2u +
+           (channelWidth == NARROW_CHANNEL_WIDTH) * 3u;
+}
+
+// 1 for the congested 2.4GHz channels 1-11
+constexpr uint32_t congestionClass(int channel) {
+    return (channel >= CONGESTED_CHANNEL_FIRST) & (channel <= CONGESTED_CHANNEL_LAST);
+}
+
+// 0 = weak (below -70 dBm), 1 = moderate, 2 = good, 3 = very strong (-30 dBm or more)
+constexpr uint32_t signalClass(int signalStrength) {
+    return (signalStrength >= MODERATE_SIGNAL) + (signalStrength >= GOOD_SIGNAL) +
+           (signalStrength >= VERY_STRONG_SIGNAL);
+}
+
+// 0 = below 100 Mbps, 1 = 100 Mbps+, 2 = 1 Gbps+
+constexpr uint32_t rateClass(int maxDataRate) {
+    return (maxDataRate >= FAST_RATE) + (maxDataRate >= GIGABIT_RATE);
+}
+
+// 0 = below 50ms, 1 = 50-200ms, 2 = above 200ms
+constexpr uint32_t beaconClass(int beaconInterval) {
+    return (beaconInterval >= NORMAL_BEACON_START) + (beaconInterval > LONG_BEACON_ABOVE);
+}
+
+// ---- Rules, one cell per class combination ----
+
+constexpr int encryptionCell(uint32_t securityType) {
+    constexpr int scores[8] = {15, 25, 50, 80, 95, 100, 110, 35};
+    return scores[securityType];
+}
+
+constexpr int authenticationCell(bool enterprise, bool guest) {
+    int score = (enterprise ? 30 : 15) - (guest ? 15 : 0);
+    return score < 0 ? 0 : score;
+}
+
+constexpr int channelCell(uint32_t band, uint32_t width, bool congested) {
+    constexpr int bandScores[4] = {0, 15, 25, 30};
+    constexpr int widthScores[4] = {0, 2, 5, 8};
+    int score = bandScores[band] + widthScores[width] - (congested ? 2 : 0);
+    return score < 0 ? 0 : score;
+}
+
+constexpr int featureCell(bool pmf, bool owe, bool wps, bool hidden) {
+    int score = (pmf ? 20 : 0) + (owe ? 15 : 0) - (wps ? 10 : 0) - (hidden ? 5 : 0);
+    return score < 0 ? 0 : score;
+}
+
+constexpr int configurationCell(uint32_t signal, uint32_t rate, bool enterprise) {
+    constexpr int signalScores[4] = {8, 5, 2, -5};
+    constexpr int rateScores[3] = {0, 3, 5};
+    int score = signalScores[signal] + rateScores[rate] + (enterprise ? 5 : 0);
+    return score < 0 ? 0 : score;
+}
+
+constexpr int advancedCell(bool rogue, bool evilTwin, bool typoSquatting, bool probes,
+                           bool anomalous, uint32_t beacon) {
+    constexpr int beaconScores[3] = {-5, 0, 2};
+    int score = -(rogue ? 25 : 0) - (evilTwin ? 20 : 0) - (typoSquatting ? 15 : 0) -
+                (anomalous ? 10 : 0) - (probes ? 3 : 0) + beaconScores[beacon];
+    return score < -30 ? -30 : score;
+}
+
+// ---- Table indices (flags are NetworkFlag bits) ----
+
+constexpr size_t ENCRYPTION_CELLS = 8;
+constexpr size_t AUTHENTICATION_CELLS = 4;
+constexpr size_t CHANNEL_CELLS = 4 * 4 * 2;
+constexpr size_t FEATURE_CELLS = 16;
+constexpr size_t CONFIGURATION_CELLS = 4 * 3 * 2;
+constexpr size_t ADVANCED_CELLS = 32 * 3;
+
+// Out-of-range security types score as UNKNOWN
+constexpr uint32_t encryptionIndex(int securityType) {
+    return static_cast<uint32_t>(securityType) > 7 ? 7 : static_cast<uint32_t>(securityType);
+}
+
+// bit 0 = enterprise, bit 1 = guest
+constexpr uint32_t authenticationIndex(uint32_t flags) {
+    return ((flags & FLAG_ENTERPRISE) >> 1) | ((flags & FLAG_GUEST) >> 4);
+}
+
+constexpr uint32_t channelIndex(int frequency, int channelWidth, int channel) {
+    return (bandClass(frequency) * 4 + widthClass(channelWidth)) * 2 + congestionClass(channel);
+}
+
+// bit 0 = hidden, bit 1 = WPS, bit 2 = PMF, bit 3 = OWE
+constexpr uint32_t featureIndex(uint32_t flags) {
+    return (flags & FLAG_HIDDEN) | ((flags >> 1) & 0xE);
+}
+
+constexpr uint32_t configurationIndex(int signalStrength, int maxDataRate, uint32_t flags) {
+    return (signalClass(signalStrength) * 3 + rateClass(maxDataRate)) * 2 + ((flags & FLAG_ENTERPRISE) >> 1);
+}
+
+// Threat flags (rogue, evil twin, typo squatting, probes, anomalous) times beacon class
+constexpr uint32_t advancedIndex(uint32_t flags, int beaconInterval) {
+    return ((flags >> 6) & 0x1F) * 3 + beaconClass(beaconInterval);
+}
+
+// ---- Table generation ----
+
+template <size_t N, typename Rule>
+constexpr std::array<int8_t, N> buildTable(Rule rule) {
+    std::array<int8_t, N> table{};
+    for (size_t i = 0; i < N; ++i) {
+        table[i] = static_cast<int8_t>(rule(static_cast<uint32_t>(i)));
+    }
+    return table;
+}
+
+template <size_t N>
+constexpr std::array<int32_t, N> widenTable(const std::array<int8_t, N>& table) {
+    std::array<int32_t, N> wide{};
+    for (size_t i = 0; i < N; ++i) {
+        wide[i] = table[i];
+    }
+    return wide;
+}
+
+template <size_t N>
+constexpr std::array<double, N> weighTable(const std::array<int8_t, N>& table, double weight) {
+    std::array<double, N> weighted{};
+    for (size_t i = 0; i < N; ++i) {
+        weighted[i] = table[i] * weight;
+    }
+    return weighted;
+}
+
+inline constexpr auto ENCRYPTION = buildTable<ENCRYPTION_CELLS>([](uint32_t i) {
+    return encryptionCell(i);
+});
+
+inline constexpr auto AUTHENTICATION = buildTable<AUTHENTICATION_CELLS>([](uint32_t i) {
+    return authenticationCell(i & 1, i & 2);
+});
+
+inline constexpr auto CHANNEL = buildTable<CHANNEL_CELLS>([](uint32_t i) {
+    return channelCell(i / 8, (i / 2) % 4, i & 1);
+});
+
+inline constexpr auto FEATURE = buildTable<FEATURE_CELLS>([](uint32_t i) {
+    return featureCell(i & 4, i & 8, i & 2, i & 1);
+});
+
+inline constexpr auto CONFIGURATION = buildTable<CONFIGURATION_CELLS>([](uint32_t i) {
+    return configurationCell(i / 6, (i / 2) % 3, i & 1);
+});
+
+inline constexpr auto ADVANCED = buildTable<ADVANCED_CELLS>([](uint32_t i) {
+    uint32_t threats = i / 3;
+    return advancedCell(threats & 1, threats & 2, threats & 4, threats & 8, threats & 16, i % 3);
+});
+
+// 32-bit copies for the SIMD kernels, which load one lane per entry
+inline constexpr auto WIDE_ENCRYPTION = widenTable(ENCRYPTION);
+inline constexpr auto WIDE_AUTHENTICATION = widenTable(AUTHENTICATION);
+inline constexpr auto WIDE_CHANNEL = widenTable(CHANNEL);
+inline constexpr auto WIDE_FEATURE = widenTable(FEATURE);
+inline constexpr auto WIDE_CONFIGURATION = widenTable(CONFIGURATION);
+inline constexpr auto WIDE_ADVANCED = widenTable(ADVANCED);
+
+// Pre-weighted copies: entry * weight is folded at compile time with the same
+// rounding as the runtime multiply, so sums over these tables are bit-identical
+// to the weighted sum in the reference implementation.
+inline constexpr auto WEIGHTED_ENCRYPTION = weighTable(ENCRYPTION, ENCRYPTION_WEIGHT);
+inline constexpr auto WEIGHTED_AUTHENTICATION = weighTable(AUTHENTICATION, AUTHENTICATION_WEIGHT);
+inline constexpr auto WEIGHTED_CHANNEL = weighTable(CHANNEL, CHANNEL_WEIGHT);
+inline constexpr auto WEIGHTED_FEATURE = weighTable(FEATURE, FEATURE_WEIGHT);
+inline constexpr auto WEIGHTED_CONFIGURATION = weighTable(CONFIGURATION, CONFIGURATION_WEIGHT);
+inline constexpr auto WEIGHTED_ADVANCED = weighTable(ADVANCED, ADVANCED_WEIGHT);
+
+// Spot checks against the documented rules; the exhaustive comparison with the
+// reference functions lives in tests/test_security_grader.cpp
+static_assert(ENCRYPTION[static_cast<int>(SecurityType::WPA3_ENTERPRISE)] == 110, "WPA3-Enterprise base score");
+static_assert(ENCRYPTION[encryptionIndex(42)] == 35, "out-of-range types score as UNKNOWN");
+static_assert(AUTHENTICATION[authenticationIndex(FLAG_GUEST)] == 0, "personal guest networks floor at 0");
+static_assert(CHANNEL[channelIndex(6115, 20, 1)] == 36, "6GHz 20MHz on a congested channel number");
+static_assert(CHANNEL[channelIndex(0, 0, 0)] == 0, "unknown band and width");
+static_assert(FEATURE[featureIndex(FLAG_WPS | FLAG_HIDDEN)] == 0, "penalty-only feature score floors at 0");
+static_assert(CONFIGURATION[configurationIndex(-30, 2000, FLAG_ENTERPRISE)] == 5, "strong signal, gigabit, enterprise");
+static_assert(ADVANCED[advancedIndex(FLAG_ROGUE_AP | FLAG_EVIL_TWIN, 25)] == -30, "advanced score floors at -30");
+static_assert(ADVANCED[advancedIndex(0, 300)] == 2, "long beacon interval bonus");
+
+} // namespace ScoringTables
+
+} // namespace WifiScanner
@@ -1,38 +1,147 @@
 #pragma once
 
 #include "NetworkInfo.h"
+#include "NetworkBatch.h"
+#include "CompactNetwork.h"
+#include "NetworkTable.h"
+#include "ScoreCache.h"
+#include "WeightProfile.h"
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
-#include <unordered_map>
 
 namespace WifiScanner {
 
+// Instruction set used by the batch scoring kernels
+enum class SimdLevel {
+    SCALAR,
+    SSE42,
+    AVX2
+};
+
+// How bulk grading spreads its work across threads
+struct ExecutionPolicy {
+    size_t threads = 1;  // 0 = one per hardware thread
+    
+    static ExecutionPolicy sequential() { return ExecutionPolicy{1}; }
+    static ExecutionPolicy parallel(size_t threads = 0) { return ExecutionPolicy{threads}; }
+};
+
+// Every score component of one network, computed in a single pass.
+// Components are the unweighted calculate*Score values; score and grade are
+// exactly what scoreNetwork() and gradeNetwork() return under the active profile.
+
+struct ScoreBreakdown {
+    int16_t encryption = 0;
+    int16_t authentication = 0;
+    int16_t channel = 0;
+    int16_t feature = 0;
+    int16_t configuration = 0;
+    int16_t vendor = 0;
+    int16_t advanced = 0;
+    int16_t score = 0;
+    SecurityGrade grade = SecurityGrade::VERY_BAD;
+};
+
 class SecurityGrader {
 public:
     SecurityGrader();
+    explicit SecurityGrader(size_t cacheCapacity);
     ~SecurityGrader() = default;
     
     // Grade a single network
     SecurityGrade gradeNetwork(const NetworkInfo& network) const;
     
+    // Numerical security score (0-100) for a single network, uncached
+    int scoreNetwork(const NetworkInfo& network) const;
+    
+    // Per-component scores, total and grade for a single network, uncached
+    ScoreBreakdown scoreBreakdown(const NetworkInfo& network) const;
+    
+    // The same for compact networks; results are identical to the NetworkInfo form
+    SecurityGrade gradeNetwork(const CompactNetwork& network) const;
+    int scoreNetwork(const CompactNetwork& network) const;
+    ScoreBreakdown scoreBreakdown(const CompactNetwork& network) const;
+    
+    // Breakdown of a table row, read from its columns
+    ScoreBreakdown scoreBreakdown(const NetworkTable::Row& network) const;
+    
+    // Score with a loaded weight profile instead of the built-in weights; null
+    // restores the built-in weights. Clears the score cache, so it must not be
+    // called while other threads are grading with this instance.
+    void setProfile(std::shared_ptr<const ProfileEvaluator> profile);
+    const ProfileEvaluator* profile() const { return profile_.get(); }
+    
+    // Total of a breakdown's components with the built-in weights, whatever
+    // profile is set; the score `scan` shows without a profile
+    static int builtinScore(const ScoreBreakdown& components);
+    
+    // Grade band for a 0-100 score with the built-in thresholds
+    static SecurityGrade gradeFromScore(int score) {
+        if (score >= 70) return SecurityGrade::EXCELLENT;
+        if (score >= 55) return SecurityGrade::GOOD;
+        if (score >= 40) return SecurityGrade::OKAY;
+        if (score >= 20) return SecurityGrade::BAD;
+        return SecurityGrade::VERY_BAD;
+    }
+    
+    // Grade every row of a columnar batch in one pass using the best
+    // instruction set available. Either output array may be null.
+    void gradeBatch(const NetworkBatchView& batch, int* scores, SecurityGrade* grades) const;
+    
+    // Same as above with an explicit kernel; falls back if the CPU lacks it
+    void gradeBatch(const NetworkBatchView& batch, int* scores, SecurityGrade* grades,
+                    SimdLevel level) const;
+    
     // Grade multiple networks and return sorted by security
     std::vector<NetworkInfo> gradeAndSortNetworks(const std::vector<NetworkInfo>& networks) const;
     
+    // Same ordering, with scoring and sorting split into chunks on the shared
+    // thread pool and the sorted runs merged afterwards
+    std::vector<NetworkInfo> gradeAndSortNetworks(const std::vector<NetworkInfo>& networks,
+                                                  ExecutionPolicy policy) const;
+    std::vector<CompactNetwork> gradeAndSortNetworks(const std::vector<CompactNetwork>& networks,
+                                                     ExecutionPolicy policy = ExecutionPolicy::sequential()) const;
+    
+    // Row indices of a columnar table, best first, in gradeAndSortNetworks order.
+    // Scores straight from the table's columns without building a batch.
+    std::vector<uint32_t> rankNetworks(const NetworkTable& table,
+                                       ExecutionPolicy policy = ExecutionPolicy::sequential()) const;
+    NetworkTable gradeAndSortNetworks(const NetworkTable& table,
+                                      ExecutionPolicy policy = ExecutionPolicy::sequential()) const;
+    
+    // Smallest chunk worth handing to another thread
+    static constexpr size_t MIN_PARALLEL_CHUNK = 4096;
+    
     // Get security grade as string
     static std::string gradeToString(SecurityGrade grade);
     
     // Get security type as string
     static std::string securityTypeToString(SecurityType type);
     
-    // Performance optimization methods
-    int getCachedScore(const NetworkInfo& network) const;
-    void clearCache() const;
+    // Get SIMD level as string
+    static std::string simdLevelToString(SimdLevel level);
     
-private:
-    // Calculate numerical score for security grading
-    int calculateSecurityScore(const NetworkInfo& network) const;
+    // Best batch kernel supported by the running CPU
+    static SimdLevel detectSimdLevel();
     
-    // Individual scoring components
+    // 64-bit ascending sort key: score band, then non-rogue, enterprise and
+    // PMF tiers, then exact score, then input position (NetworkFlag bits)
+    static uint64_t makeRankingKey(int score, uint32_t flags, uint32_t index);
+    static uint32_t rankingKeyIndex(uint64_t key);
+    
+    // Sort ranking keys in place (LSD radix sort)
+    static void radixSortKeys(std::vector<uint64_t>& keys);
+    
+    // Width of the score bands inside which the tie-break tiers apply
+    static constexpr int RANKING_BAND_WIDTH = 5;
+    
+    // Vendor reputation component for a vendor name
+    static int vendorScore(const std::string& vendor);
+    
+    // Individual scoring components. These are the reference rules; the
+    // grading paths use the tables in ScoringTables.h, which are tested against them.
     int calculateEncryptionScore(SecurityType securityType) const;
     int calculateAuthenticationScore(const NetworkInfo& network) const;
     int calculateChannelScore(const NetworkInfo& network) const;
@@ -41,8 +150,34 @@ private:
     int calculateVendorScore(const NetworkInfo& network) const;
     int calculateAdvancedSecurityScore(const NetworkInfo& network) const;
     
-    // Performance optimization: Score caching
-    mutable std::unordered_map<std::string, int> scoreCache_;
+    // Performance optimization methods (thread-safe)
+    int getCachedScore(const NetworkInfo& network) const;
+    void clearCache() const;
+    ScoreCacheStats getCacheStats() const;
+    
+private:
+    // Calculate numerical score for security grading
+    int calculateSecurityScore(const NetworkInfo& network) const;
+    
+    // Bodies shared by the NetworkInfo, CompactNetwork and table row overloads
+    template <typename Network>
+    int scoreFields(const Network& network, int vendorComponent) const;
+    template <typename Network>
+    ScoreBreakdown breakdownFields(const Network& network, int vendorScore) const;
+    template <typename Network>
+    std::vector<Network> sortByRanking(const std::vector<Network>& networks, ExecutionPolicy policy) const;
+    
+    // Sorted ranking keys of `count` rows; chunkRows(begin, end, scratch) returns
+    // the rows [begin, end) as a batch, filling `scratch` if it has to copy
+    template <typename ChunkRows>
+    std::vector<uint64_t> sortedRankingKeys(size_t count, ExecutionPolicy policy, ChunkRows chunkRows) const;
+    static size_t chunkCount(size_t count, ExecutionPolicy policy);
+    
+    // Performance optimization: Score caching keyed on a full input fingerprint
+    mutable ScoreCache scoreCache_;
+    
+    // Active weight profile; null uses the built-in weights
+    std::shared_ptr<const ProfileEvaluator> profile_;
 };
 
 } // namespace WifiScanner
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "NetworkTable.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace WifiScanner {
+
+enum class SsidCategory : uint8_t {
+    GUEST,      // Guest and public networks; sets NetworkInfo::isGuestNetwork
+    CORPORATE,  // Known corporate network names
+    WATCHLIST,  // Names to flag during threat analysis
+    HOTSPOT     // Hotspot provider and venue chains
+};
+
+// Bit set of SsidCategory values
+using SsidClasses = uint8_t;
+
+constexpr SsidClasses ssidClass(SsidCategory category) {
+    return static_cast<SsidClasses>(1u << static_cast<unsigned>(category));
+}
+
+// Matches when the pattern occurs anywhere in the SSID, ignoring ASCII case
+struct SsidRule {
+    SsidCategory category;
+    std::string pattern;
+};
+
+// Classifies SSIDs against every pattern of every category in one pass.
+//
+// The rules are compiled into an Aho–Corasick automaton with the failure
+// links folded into a dense transition table over the bytes the patterns use,
+// so classifying an SSID is one table load per byte, whatever the number of
+// patterns. Each state carries the categories of every pattern ending there.
+class SsidClassifier {
+public:
+    // Shared by every platform scanner: the default rules, plus the rules file
+    // named by the WIFI_SCANNER_SSID_RULES environment variable if set.
+    // Throws std::runtime_error if the named file cannot be loaded.
+    static const SsidClassifier& instance();
+
+    // The guest-network keywords the scanners have always used
+    static std::vector<SsidRule> defaultRules();
+
+    // A rules file: "[guest]", "[corporate]", "[watchlist]" or "[hotspot]"
+    // starts a section, and every other line is one pattern of that section.
+    // Blank lines and lines starting with '#' are skipped. Throws
+    // std::runtime_error for unreadable files, unknown sections and patterns
+    // outside a section.
+    static std::vector<SsidRule> loadRules(const std::string& path);
+
+    explicit SsidClassifier(const std::vector<SsidRule>& rules = defaultRules());
+
+    SsidClasses classify(std::string_view ssid) const;
+
+    bool matches(std::string_view ssid, SsidCategory category) const {
+        return (classify(ssid) & ssidClass(category)) != 0;
+    }
+
+    // Every SSID of a sweep, in one pass over their bytes
+    std::vector<SsidClasses> classify(const std::vector<NetworkInfo>& networks) const;
+    std::vector<SsidClasses> classify(const NetworkTable& table) const;
+
+    size_t patternCount() const { return patterns_; }
+    size_t stateCount() const { return classOutputs_.size(); }
+
+private:
+    uint8_t byteClass_[256] = {};         // Lower-cased byte -> alphabet index; 0 = in no pattern
+    size_t alphabet_ = 1;
+    std::vector<uint32_t> transitions_;   // stateCount x alphabet_
+    std::vector<SsidClasses> classOutputs_;
+    size_t patterns_ = 0;
+};
+
+} // namespace WifiScanner
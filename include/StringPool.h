@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace WifiScanner {
+
+// Thread-safe interning of strings into dense 16-bit IDs.
+//
+// ID 0 (NONE) stands for the empty string and is also returned when the pool
+// is full. Interned strings are never removed, so references returned by
+// lookup() stay valid for the lifetime of the pool.
+class StringPool {
+public:
+    static constexpr uint16_t NONE = 0;
+
+    // At most `capacity` - 1 distinct non-empty strings (capacity <= 65536)
+    explicit StringPool(size_t capacity);
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    // Returns the ID for a string, registering it on first use
+    uint16_t intern(const std::string& value);
+
+    // String for an ID; empty for NONE and unknown IDs
+    const std::string& lookup(uint16_t id) const;
+
+    size_t size() const;
+    size_t capacity() const { return capacity_; }
+
+private:
+    const size_t capacity_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, uint16_t> ids_;
+    std::deque<std::string> values_;  // values_[id - 1]
+};
+
+} // namespace WifiScanner
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "WifiScanner.h"
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace WifiScanner {
+
+// Shape of a generated RF environment. The same settings always produce the
+// same environment and the same sequence of sweeps, on every platform.
+struct SyntheticEnvironment {
+    uint32_t seed = 1;
+    size_t bssCount = 1000;     // Every BSS in the environment, evil twins included
+    int maxApsPerEss = 6;       // Most ESSes are one home AP; the rest have 2..maxApsPerEss
+    double driftRate = 0.05;    // Chance per sweep that a BSS reports a new RSSI
+    int driftDb = 3;            // Largest RSSI step in one sweep
+    double churn = 0.01;        // Chance per sweep that a visible BSS drops out
+    double hiddenRate = 0.05;   // Share of ESSes that hide their SSID
+    double evilTwinRate = 0.01; // Share of named ESSes that get impersonated
+};
+
+// A scanner over a generated environment, for load tests and reproducible
+// benchmarks of the monitor loop, incremental grading and threat detection.
+//
+// The environment is a set of ESSes, each with one or more APs that have a
+// 2.4 GHz radio and often 5 and 6 GHz ones, on a channel plan like a real
+// deployment's. Each sweep some BSSes drift in signal, drop out or come back,
+// and evil twins (or typosquatted copies) of real ESSes appear at random
+// sweeps. The first scan() returns the initial environment; every later one
+// advances it by a sweep.
+//
+// Only the raw std::mt19937 output is used, never the standard distributions,
+// so a seed means the same environment with every standard library.
+class SyntheticWifiScanner : public WifiScanner {
+public:
+    explicit SyntheticWifiScanner(const SyntheticEnvironment& environment = SyntheticEnvironment());
+
+    using WifiScanner::scan;
+    std::vector<NetworkInfo> scan() override;
+    void scanInto(NetworkTable& table, const ScanRequest& request) override;
+    bool isSupported() const override { return true; }
+    std::string getPlatformName() const override { return "Synthetic"; }
+
+    // Every BSS of a freshly generated environment, visible or not yet
+    static std::vector<NetworkInfo> generate(size_t bssCount, uint32_t seed = 1);
+
+    size_t bssCount() const { return networks_.size(); }
+    size_t essCount() const { return essCount_; }
+    size_t evilTwinCount() const { return evilTwinCount_; }
+    size_t sweeps() const { return sweeps_; }
+
+private:
+    struct Radio {
+        int baseSignal = 0;    // RSSI the drift wanders around
+        size_t appearAt = 0;   // Sweep the BSS first shows up in
+        bool visible = false;
+    };
+
+    bool chance(double probability);
+    void addEss();
+    void addEvilTwin(size_t target);
+    void advance();
+
+    SyntheticEnvironment environment_;
+    std::mt19937 gen_;
+    std::vector<NetworkInfo> networks_;  // Current state of every BSS
+    std::vector<Radio> radios_;
+    size_t essCount_ = 0;
+    size_t evilTwinCount_ = 0;
+    size_t apSerial_ = 0;
+    size_t sweeps_ = 0;
+};
+
+} // namespace WifiScanner
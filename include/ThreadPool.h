@@ -0,0 +1,58 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace WifiScanner {
+
+// Fixed-size pool of worker threads for data-parallel loops.
+//
+// parallelFor() hands out task indices to the workers and the calling thread,
+// and returns once every task has finished, rethrowing the first exception a
+// task threw. Calls from several threads are serialized; a task must not call
+// back into the same pool.
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t workerCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Run task(i) for every i in [0, taskCount)
+    void parallelFor(size_t taskCount, const std::function<void(size_t)>& task);
+
+    size_t workerCount() const { return workers_.size(); }
+
+    // Process-wide pool with one worker per extra hardware thread
+    static ThreadPool& shared();
+
+    // std::thread::hardware_concurrency(), never less than 1
+    static size_t hardwareThreads();
+
+private:
+    void workerLoop();
+    void runTasks();
+
+    std::vector<std::thread> workers_;
+
+    std::mutex callMutex_;  // One parallelFor at a time
+    std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable workDone_;
+
+    const std::function<void(size_t)>* task_ = nullptr;
+    size_t taskCount_ = 0;
+    size_t nextTask_ = 0;
+    size_t pendingTasks_ = 0;
+    size_t generation_ = 0;
+    bool stopping_ = false;
+    std::exception_ptr error_;
+};
+
+} // namespace WifiScanner
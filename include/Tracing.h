@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Build with -DWIFI_SCANNER_TRACING=0 (CMake option WIFI_SCANNER_TRACING=OFF)
+// to compile every trace point out entirely
+#ifndef WIFI_SCANNER_TRACING
+#define WIFI_SCANNER_TRACING 1
+#endif
+
+namespace WifiScanner {
+
+// Lightweight instrumentation for the grading pipeline.
+//
+// Trace points record stage timings and counters into a buffer owned by the
+// calling thread, so recording never takes a lock or shares a cache line.
+// snapshot() sums the buffers of every thread. Tracing is off at runtime until
+// setEnabled(true); a disabled trace point costs one relaxed atomic load.
+namespace Tracing {
+
+enum class Timer : size_t {
+    GRADE_BATCH,         // Batch kernel passes
+    RANKING_KEYS,        // Building ranking keys from scores
+    SORT_KEYS,           // Radix sort of one run of keys
+    MERGE_RUNS,          // Merging sorted runs from parallel chunks
+    GRADE_AND_SORT,      // Whole gradeAndSortNetworks call
+    INCREMENTAL_UPDATE,  // Whole IncrementalGrader::update call
+    PLATFORM_SCAN,       // Platform scanner call
+    SCORE_BREAKDOWNS,    // Component breakdowns of a whole corpus
+    SCORE_PROFILES,      // Scoring a component matrix under every weight profile
+    COUNT
+};
+
+enum class Counter : size_t {
+    NETWORKS_SCORED,     // Single-network scores (gradeNetwork, scoreNetwork, cache misses)
+    BATCH_ROWS,          // Rows graded by the batch kernels
+    NETWORKS_SORTED,     // Rows ranked by gradeAndSortNetworks
+    NETWORKS_REGRADED,   // New or changed rows regraded incrementally
+    NETWORKS_REUSED,     // Unchanged rows that kept their grade
+    SCANS,               // Platform scans
+    COUNT
+};
+
+constexpr size_t TIMER_COUNT = static_cast<size_t>(Timer::COUNT);
+constexpr size_t COUNTER_COUNT = static_cast<size_t>(Counter::COUNT);
+
+struct TimerStats {
+    uint64_t calls = 0;
+    uint64_t totalNanos = 0;
+    uint64_t maxNanos = 0;
+};
+
+struct Snapshot {
+    std::array<TimerStats, TIMER_COUNT> timers{};
+    std::array<uint64_t, COUNTER_COUNT> counters{};
+};
+
+// Whether trace points were compiled in
+constexpr bool compiledIn() { return WIFI_SCANNER_TRACING != 0; }
+
+namespace detail {
+inline std::atomic<bool> enabledFlag{false};
+}
+
+// Runtime switch (off by default); has no effect when not compiled in
+void setEnabled(bool enabled);
+
+inline bool enabled() {
+    return compiledIn() && detail::enabledFlag.load(std::memory_order_relaxed);
+}
+
+// Totals over all threads, including threads that have exited
+Snapshot snapshot();
+
+// Zero every buffer. Records made while a reset is running may survive it.
+void reset();
+
+const char* timerName(Timer timer);
+const char* counterName(Counter counter);
+
+// Recording primitives behind the macros below
+void record(Timer timer, uint64_t nanos);
+void add(Counter counter, uint64_t amount);
+
+// Times its own lifetime when tracing was enabled at construction
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Timer timer) : timer_(timer), active_(enabled()) {
+        if (active_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+    
+    ~ScopedTimer() {
+        if (active_) {
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            record(timer_, static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+    }
+    
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    
+private:
+    Timer timer_;
+    bool active_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace Tracing
+
+} // namespace WifiScanner
+
+#define WIFI_TRACE_CONCAT_INNER(a, b) a##b
+#define WIFI_TRACE_CONCAT(a, b) WIFI_TRACE_CONCAT_INNER(a, b)
+
+#if WIFI_SCANNER_TRACING
+// Time the rest of the enclosing scope
+#define WIFI_TRACE_SCOPE(timer) \
+    ::WifiScanner::Tracing::ScopedTimer WIFI_TRACE_CONCAT(wifiTraceTimer_, __LINE__)(::WifiScanner::Tracing::Timer::timer)
+// Add to a counter
+#define WIFI_TRACE_COUNT(counter, amount) \
+    do { \
+        if (::WifiScanner::Tracing::enabled()) { \
+            ::WifiScanner::Tracing::add(::WifiScanner::Tracing::Counter::counter, (amount)); \
+        } \
+    } while (0)
+#else
+#define WIFI_TRACE_SCOPE(timer) ((void)0)
+#define WIFI_TRACE_COUNT(counter, amount) ((void)0)
+#endif
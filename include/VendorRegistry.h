@@ -0,0 +1,43 @@
+#pragma once
+
+#include "StringPool.h"
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace WifiScanner {
+
+// Process-wide interning of vendor names into small integer IDs.
+//
+// Scanners intern NetworkInfo::vendor once when they fill in a network, and the
+// grader maps the ID to a precomputed reputation score with a single array load.
+// ID 0 means "not interned" and makes the grader fall back to string matching.
+class VendorRegistry {
+public:
+    static constexpr uint16_t NO_VENDOR = 0;
+    static constexpr size_t MAX_VENDORS = 4096;
+
+    static VendorRegistry& instance();
+
+    // Returns the ID for a vendor name, registering it on first use.
+    // Returns NO_VENDOR for empty names or when the registry is full.
+    uint16_t intern(const std::string& vendor);
+
+    // Vendor reputation component for an interned ID (0 for NO_VENDOR)
+    int score(uint16_t vendorId) const { return vendorId < MAX_VENDORS ? scores_[vendorId] : 0; }
+
+    // Vendor name for an interned ID (empty for NO_VENDOR)
+    const std::string& name(uint16_t vendorId) const { return names_.lookup(vendorId); }
+
+    size_t size() const;
+
+private:
+    VendorRegistry() : names_(MAX_VENDORS) {}
+
+    std::mutex mutex_;  // Serializes registration with score classification
+    StringPool names_;
+    // Written before an ID is handed out and never modified afterwards
+    int8_t scores_[MAX_VENDORS] = {};
+};
+
+} // namespace WifiScanner
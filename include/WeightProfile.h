@@ -0,0 +1,130 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include "NetworkBatch.h"
+#include "ScoringTables.h"
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace WifiScanner {
+
+struct ScoreBreakdown;
+
+// Component weights and grade thresholds of one scoring policy. The defaults
+// are the built-in weights in ScoringTables.h and the SecurityGrader::gradeFromScore bands.
+struct WeightProfile {
+    std::string name = "default";
+
+    double encryption = ScoringTables::ENCRYPTION_WEIGHT;
+    double authentication = ScoringTables::AUTHENTICATION_WEIGHT;
+    double channel = ScoringTables::CHANNEL_WEIGHT;
+    double feature = ScoringTables::FEATURE_WEIGHT;
+    double configuration = ScoringTables::CONFIGURATION_WEIGHT;
+    double vendor = ScoringTables::VENDOR_WEIGHT;
+    double advanced = ScoringTables::ADVANCED_WEIGHT;
+
+    // Lowest score of each grade band
+    int excellent = 70;
+    int good = 55;
+    int okay = 40;
+    int bad = 20;
+};
+
+// A WeightProfile compiled into fixed-point lookup tables.
+//
+// Weights are stored in 1/SCALE units, so a profile costs the same table loads
+// as the built-in weights, with integer adds instead of double adds. Weights
+// with up to four decimal places are represented exactly, and halfway totals
+// always round up.
+class ProfileEvaluator {
+public:
+    static constexpr int32_t SCALE = 10000;
+
+    explicit ProfileEvaluator(const WeightProfile& profile);
+
+    const WeightProfile& profile() const { return profile_; }
+    const std::string& name() const { return profile_.name; }
+
+    // 0-100 score of one network (NetworkInfo or CompactNetwork), given its vendor component
+    template <typename Network>
+    int score(const Network& network, int vendorScore) const {
+        using namespace ScoringTables;
+        const uint32_t flags = packNetworkFlags(network);
+
+        int64_t total = encryption_[encryptionIndex(static_cast<int>(network.securityType))];
+        total += authentication_[authenticationIndex(flags)];
+        total += channel_[channelIndex(network.frequency, network.channelWidth, network.channel)];
+        total += feature_[featureIndex(flags)];
+        total += configuration_[configurationIndex(network.signalStrength, network.maxDataRate, flags)];
+        total += static_cast<int64_t>(vendorScore) * weights_.vendor;
+        total += advanced_[advancedIndex(flags, network.beaconInterval)];
+        return finish(total);
+    }
+
+    // 0-100 score from already computed components
+    int score(const ScoreBreakdown& breakdown) const;
+
+    SecurityGrade grade(int score) const {
+        return grades_[score < 0 ? 0 : (score > 100 ? 100 : score)];
+    }
+
+    // Score and grade every row of a batch with the scalar tables; either
+    // output may be null. SecurityGrader::gradeBatch adds SIMD kernels on top.
+    void gradeBatch(const NetworkBatchView& batch, int* scores, SecurityGrade* grades) const;
+
+    // Component weights in 1/SCALE units
+    struct FixedWeights {
+        int32_t encryption, authentication, channel, feature, configuration, vendor, advanced;
+    };
+    const FixedWeights& weights() const { return weights_; }
+
+private:
+    int finish(int64_t total) const;
+
+    WeightProfile profile_;
+    FixedWeights weights_;
+    std::array<int32_t, ScoringTables::ENCRYPTION_CELLS> encryption_;
+    std::array<int32_t, ScoringTables::AUTHENTICATION_CELLS> authentication_;
+    std::array<int32_t, ScoringTables::CHANNEL_CELLS> channel_;
+    std::array<int32_t, ScoringTables::FEATURE_CELLS> feature_;
+    std::array<int32_t, ScoringTables::CONFIGURATION_CELLS> configuration_;
+    std::array<int32_t, ScoringTables::ADVANCED_CELLS> advanced_;
+    std::array<SecurityGrade, 101> grades_;
+};
+
+// Named weight profiles loaded from INI-style config files:
+//
+//   # comment
+//   [corporate]
+//   encryption = 0.40
+//   excellent = 75
+//
+// Keys left out of a section keep their built-in values. "default" is reserved
+// for the built-in weights. Parse errors throw std::runtime_error naming the
+// source and line; a file that fails to parse adds no profiles.
+class ProfileRegistry {
+public:
+    static constexpr const char* DEFAULT_PROFILE = "default";
+    static constexpr double MAX_WEIGHT = 10.0;
+
+    // Returns the number of profiles loaded
+    size_t loadFile(const std::string& path);
+    size_t loadString(const std::string& text, const std::string& source = "<string>");
+
+    // Loaded profile by name, or null if there is none
+    std::shared_ptr<const ProfileEvaluator> find(const std::string& name) const;
+
+    std::vector<std::string> names() const;
+    size_t size() const { return profiles_.size(); }
+
+    static std::vector<WeightProfile> parse(const std::string& text, const std::string& source);
+
+private:
+    std::map<std::string, std::shared_ptr<const ProfileEvaluator>> profiles_;
+};
+
+} // namespace WifiScanner
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "NetworkInfo.h"
+#include "ScanRequest.h"
 #include <vector>
 #include <memory>
 
 namespace WifiScanner {
 
+class NetworkTable;
+
 class WifiScanner {
 public:
     virtual ~WifiScanner() = default;
@@ -13,6 +16,16 @@ public:
     // Scan for available networks
     virtual std::vector<NetworkInfo> scan() = 0;
     
+    // Scan as the request asks. The default runs a full scan() and keeps the
+    // requested channels; backends that can read the driver's cached table or
+    // tune the radio to fewer channels override it.
+    virtual std::vector<NetworkInfo> scan(const ScanRequest& request);
+    
+    // Scan as the request asks and append the results to a table, e.g. one on
+    // a ScanArena. The default copies from scan(request); backends that parse
+    // text override it to append as they parse.
+    virtual void scanInto(NetworkTable& table, const ScanRequest& request);
+    
     // Check if scanning is supported on this platform
     virtual bool isSupported() const = 0;
     
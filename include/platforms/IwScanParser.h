@@ -0,0 +1,75 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include "platforms/ScanDecoding.h"
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace WifiScanner {
+
+// Parses the complete output of `iw dev <if> scan` in a single pass, one line
+// at a time, so it can be fed straight from the pipe without buffering the
+// whole scan or filtering it through grep first.
+//
+// Besides the BSSID, SSID, frequency and signal it reads the blocks iw prints
+// for each information element:
+// - capability and beacon interval;
+// - RSN/WPA: AKM suites (PSK, SAE, OWE, 802.1X...), ciphers, MFP-capable/required;
+// - HT/VHT/HE capabilities and operation: stream counts and the real channel width;
+// - WPS and the supported rates.
+// The results go through the same applyBssCapabilities() as nl80211, so both
+// backends describe a BSS identically.
+class IwScanParser {
+public:
+    // Called once per BSS with a reused NetworkInfo that the sink may complete
+    // before copying; it is only valid during the call
+    using NetworkSink = std::function<void(NetworkInfo&)>;
+
+    explicit IwScanParser(NetworkSink sink);
+
+    // One line of output, with or without its line ending
+    void feedLine(std::string_view line);
+
+    // Emit the last BSS; call once the output has ended
+    void finish();
+
+    size_t count() const { return count_; }
+
+private:
+    // The element block that indented lines belong to
+    enum class Block {
+        None,
+        Rsn,
+        Wpa,
+        HtCapabilities,
+        HtOperation,
+        VhtCapabilities,
+        VhtOperation,
+        HeCapabilities,
+        HeOperation,
+        Other
+    };
+
+    void beginBss(std::string_view line);
+    void parseField(std::string_view line);
+    void parseBlockItem(std::string_view item);
+    void parseSecurityItem(std::string_view item, uint32_t& akms, uint32_t& ciphers);
+    void emit();
+
+    NetworkSink sink_;
+    NetworkInfo network_;
+    BssCapabilities bss_;
+    Block block_ = Block::None;
+    bool inBss_ = false;
+    bool hasSsid_ = false;
+    bool countingStreams_ = false;  // Inside a VHT/HE "RX MCS set" list
+    int htWidth_ = 20;
+    int vhtWidthCode_ = 0;
+    int vhtSegment1_ = 0;
+    int vhtSegment2_ = 0;
+    int heWidth_ = 0;
+    size_t count_ = 0;
+};
+
+} // namespace WifiScanner
@@ -1,6 +1,11 @@
 #pragma once
 
 #include "WifiScanner.h"
+#include "platforms/ScanBackends.h"
+#include "ThreadPool.h"
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -9,13 +14,40 @@ namespace WifiScanner {
 class LinuxWifiScanner : public WifiScanner {
 public:
     LinuxWifiScanner();
+    // Scan with the backends another registry reports instead of the process-wide one
+    explicit LinuxWifiScanner(ScanBackendRegistry& backends);
     ~LinuxWifiScanner() override;
     
     std::vector<NetworkInfo> scan() override;
+    std::vector<NetworkInfo> scan(const ScanRequest& request) override;
+    void scanInto(NetworkTable& table, const ScanRequest& request) override;
     bool isSupported() const override;
     std::string getPlatformName() const override;
     
+    // Receives each parsed network; the reference is only valid during the call
+    using NetworkSink = std::function<void(const NetworkInfo&)>;
+    
+    // Text parsers for `iw dev <if> scan` and `nmcli -t` output. The sink forms
+    // reuse one NetworkInfo for every network and return how many were emitted.
+    // iw output is read in full (see IwScanParser); hidden networks are included.
+    std::vector<NetworkInfo> parseIwScanOutput(const std::string& output) const;
+    size_t parseIwScanOutput(const std::string& output, const NetworkSink& sink) const;
+    std::vector<NetworkInfo> parseNmcliOutput(const std::string& output) const;
+    size_t parseNmcliOutput(const std::string& output, const NetworkSink& sink) const;
+    
+    // Decoder for recorded nl80211 GET_SCAN replies (see Nl80211Socket::setCapture)
+    std::vector<NetworkInfo> parseNl80211Dump(const std::string& capture) const;
+    size_t parseNl80211Dump(const std::string& capture, const NetworkSink& sink) const;
+    
+    // Merge the results of several radios by BSSID. The strongest observation
+    // of each BSS is kept, and its `radios` lists every interface that saw it.
+    static std::vector<NetworkInfo> mergeRadioScans(std::vector<std::vector<NetworkInfo>>& perRadio);
+    
 private:
+    // Runs the available backends in order of preference until one reports
+    // networks, keeping those on the requested channels
+    size_t scanWith(const ScanRequest& request, const NetworkSink& sink) const;
+    
     // Helper methods for Linux Wi-Fi scanning
     SecurityType parseSecurityType(const std::string& securityString) const;
     int parseSignalStrength(int rssi) const;
@@ -23,12 +55,18 @@ private:
     int channelToFrequency(int channel) const;
     
     // Alternative scanning methods
-    std::vector<NetworkInfo> scanUsingIw() const;
-    std::vector<NetworkInfo> scanInterfaceWithIw(const std::string& interface) const;
-    std::vector<NetworkInfo> parseIwScanOutput(const std::string& output) const;
-    std::vector<NetworkInfo> scanUsingNetworkManager() const;
-    std::vector<NetworkInfo> parseNmcliOutput(const std::string& output) const;
-    std::vector<NetworkInfo> scanUsingProcNet() const;
+    size_t scanUsingNl80211(const ScanRequest& request, const NetworkSink& sink) const;
+    size_t scanUsingIw(const ScanRequest& request, const NetworkSink& sink) const;
+    std::vector<std::string> listIwInterfaces() const;
+    // Run task(i) for every radio at once; one sweep at a time per scanner
+    void forEachRadio(size_t radioCount, const std::function<void(size_t)>& task) const;
+    size_t scanInterfaceWithIw(const std::string& interface, const ScanRequest& request,
+                               const NetworkSink& sink) const;
+    size_t scanUsingNetworkManager(const ScanRequest& request, const NetworkSink& sink) const;
+    size_t scanUsingProcNet(const NetworkSink& sink) const;
+    
+    // Vendor and guest fields for a network decoded from nl80211 or iw output
+    void completeNetwork(NetworkInfo& network) const;
     
     // Enhanced security analysis methods
     bool detectGuestNetwork(const std::string& ssid) const;
@@ -37,7 +75,13 @@ private:
     bool checkForPMF(const std::string& capabilities) const;
     bool checkForOWE(const std::string& capabilities) const;
     bool checkForWPS(const std::string& capabilities) const;
-    int estimateDataRate(int frequency, int channelWidth) const;
+    
+    ScanBackendRegistry& backends_;
+    
+    // Radio scans block on the radio, not the CPU, so they get their own pool
+    // with a thread per radio, kept between sweeps and grown when radios are added
+    mutable std::mutex radioPoolMutex_;
+    mutable std::unique_ptr<ThreadPool> radioPool_;
 };
 
 } // namespace WifiScanner
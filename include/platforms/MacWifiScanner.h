@@ -11,6 +11,7 @@ public:
     MacWifiScanner();
     ~MacWifiScanner() override;
     
+    using WifiScanner::scan;
     std::vector<NetworkInfo> scan() override;
     bool isSupported() const override;
     std::string getPlatformName() const override;
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace WifiScanner {
+
+// Decodes the replies to an NL80211_CMD_GET_SCAN dump into NetworkInfo.
+//
+// It is fed the raw bytes of each recv() in turn. Netlink messages carry
+// their own lengths, so a capture made by concatenating those buffers replays
+// through the same code offline. Everything nl80211 reports is decoded from
+// its attributes and information elements:
+// - BSSID, frequency, signal, beacon interval and capability bits;
+// - the security type, from the RSN/WPA AKM suites;
+// - PMF, WPS and OWE;
+// - the operating channel width, from HT/VHT/HE operation;
+// - the maximum rate, from the supported rates and the HT/VHT/HE stream counts.
+class Nl80211ScanDecoder {
+public:
+    // Called once per BSS with a reused NetworkInfo that the sink may complete
+    // (e.g. with vendor data) before copying; it is only valid during the call
+    using NetworkSink = std::function<void(NetworkInfo&)>;
+
+    explicit Nl80211ScanDecoder(NetworkSink sink);
+
+    // Decode one buffer of complete netlink messages. Returns false once the
+    // dump has ended. Throws std::runtime_error on an error reply or a
+    // malformed message. Messages other than scan results are skipped.
+    bool feed(const void* data, size_t length);
+
+    size_t count() const { return count_; }
+    bool done() const { return done_; }
+
+private:
+    void decodeBss(const uint8_t* data, size_t length);
+
+    NetworkSink sink_;
+    NetworkInfo network_;
+    size_t count_ = 0;
+    bool done_ = false;
+};
+
+// A generic-netlink socket bound to the nl80211 family. All requests are
+// made in-process: no subprocesses and no text output to parse.
+class Nl80211Socket {
+public:
+    struct Interface {
+        int index;
+        std::string name;
+    };
+
+    // Throws std::runtime_error if netlink or the nl80211 family is unavailable
+    Nl80211Socket();
+    ~Nl80211Socket();
+    Nl80211Socket(const Nl80211Socket&) = delete;
+    Nl80211Socket& operator=(const Nl80211Socket&) = delete;
+
+    // Wireless interfaces in station mode
+    std::vector<Interface> interfaces();
+
+    // Start a fresh scan, of only `frequencies` (MHz) if any are given, and
+    // wait for it to finish. Returns false if it could not be started
+    // (triggering needs CAP_NET_ADMIN), was aborted or timed out; the kernel's
+    // cached results can still be dumped.
+    bool triggerScan(int ifindex, const std::vector<int>& frequencies = {},
+                     std::chrono::milliseconds timeout = std::chrono::seconds(10));
+
+    // Dump the kernel's BSS list for an interface
+    size_t dumpScanResults(int ifindex, const Nl80211ScanDecoder::NetworkSink& sink);
+
+    // Append every buffer received by dumpScanResults() to `capture`, for offline replay
+    void setCapture(std::ostream* capture) { capture_ = capture; }
+
+private:
+    std::vector<uint8_t> request(uint16_t type, uint16_t flags, uint8_t command);
+    void send(std::vector<uint8_t>& message);
+    size_t receive(int fd);
+    void resolveFamily();
+
+    int fd_ = -1;
+    uint16_t familyId_ = 0;
+    uint32_t scanGroup_ = 0;
+    uint32_t sequence_ = 0;
+    std::vector<uint8_t> buffer_;
+    std::ostream* capture_ = nullptr;
+};
+
+} // namespace WifiScanner
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "WifiScanner.h"
+#include "NetworkSnapshot.h"
+#include "platforms/LinuxWifiScanner.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace WifiScanner {
+
+enum class ReplayFormat {
+    IW,        // `iw dev <if> scan` output
+    NMCLI,     // `nmcli -t -f SSID,BSSID,CHAN,FREQ,RATE,SIGNAL,SECURITY device wifi list`
+    NL80211,   // Nl80211Socket::setCapture() output
+    SNAPSHOT   // saveSnapshot() file
+};
+
+enum class ReplayTiming {
+    FAST,     // Every scan() returns at once
+    ORIGINAL  // scan() waits until the sweep's offset into the recording
+};
+
+// One recorded sweep
+struct ReplayFrame {
+    std::string path;
+    ReplayFormat format;
+    std::chrono::milliseconds offset{0};  // Since the first sweep of the recording
+};
+
+// A scanner that replays recorded sweeps instead of using a radio, so the
+// parsing, grading and display pipeline runs deterministically on machines
+// without Wi-Fi.
+//
+// Each scan() returns the next sweep, starting again from the first after the
+// last one. Text and netlink recordings go through LinuxWifiScanner's parsers,
+// and so get the same vendor and guest fields as a live scan. All files are
+// read when the scanner is created, so a replay does no file I/O per scan;
+// unreadable or malformed recordings throw std::runtime_error there.
+class ReplayWifiScanner : public WifiScanner {
+public:
+    // Every scan replays one recording; the format is detected from its contents
+    explicit ReplayWifiScanner(const std::string& path, ReplayTiming timing = ReplayTiming::FAST);
+    explicit ReplayWifiScanner(const std::vector<ReplayFrame>& frames, ReplayTiming timing = ReplayTiming::FAST);
+    ~ReplayWifiScanner() override;
+
+    // A manifest lists one sweep per line: "<offset in ms> <file> [iw|nmcli|nl80211|snapshot]".
+    // Files are relative to the manifest; '#' starts a comment. A missing format is detected.
+    static std::vector<ReplayFrame> loadManifest(const std::string& path);
+
+    // Opens a manifest (a ".replay" file) or a single recording
+    static std::unique_ptr<ReplayWifiScanner> open(const std::string& path, ReplayTiming timing = ReplayTiming::FAST);
+
+    // Snapshot magic, then binary netlink, then a "BSS " line for iw; anything else is nmcli
+    static ReplayFormat detectFormat(const std::string& contents);
+
+    using WifiScanner::scan;
+    std::vector<NetworkInfo> scan() override;
+    bool isSupported() const override;
+    std::string getPlatformName() const override;
+
+    size_t frameCount() const { return frames_.size(); }
+
+    // Sweeps replayed so far, across restarts from the first
+    size_t sweeps() const { return sweeps_; }
+
+    // Start again from the first sweep, with the clock reset
+    void rewind();
+
+private:
+    struct LoadedFrame {
+        ReplayFormat format;
+        std::chrono::milliseconds offset;
+        std::string contents;                     // Text or netlink recordings
+        std::unique_ptr<SnapshotTable> snapshot;  // Snapshot recordings
+    };
+
+    std::vector<LoadedFrame> frames_;
+    ReplayTiming timing_;
+    LinuxWifiScanner parser_;
+    size_t next_ = 0;
+    size_t sweeps_ = 0;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace WifiScanner
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace WifiScanner {
+
+// Ways LinuxWifiScanner can get scan results, in order of preference
+enum class ScanBackend {
+    NL80211,          // Netlink requests to the kernel
+    NETWORK_MANAGER,  // nmcli
+    IW,               // iw dev <if> scan
+    PROC_NET          // /proc/net/wireless: link quality of associated interfaces only
+};
+
+// Which scan backends this system has.
+//
+// The backends are probed once, on first use, and the result is kept until
+// refresh(). Probing forks nothing: nl80211 is asked for its interfaces over
+// netlink, the tools are looked up on PATH, and /proc/net/wireless is read.
+class ScanBackendRegistry {
+public:
+    // Reports whether one backend is usable
+    using Probe = std::function<bool(ScanBackend)>;
+
+    // Process-wide registry with the real probes
+    static ScanBackendRegistry& instance();
+
+    explicit ScanBackendRegistry(Probe probe);
+
+    ScanBackendRegistry(const ScanBackendRegistry&) = delete;
+    ScanBackendRegistry& operator=(const ScanBackendRegistry&) = delete;
+
+    // The most preferred usable backend, if any
+    std::optional<ScanBackend> best() const;
+
+    // Every usable backend, most preferred first
+    std::vector<ScanBackend> available() const;
+
+    bool isAvailable(ScanBackend backend) const;
+
+    // Probe again on next use, e.g. after a radio or tool has been added
+    void refresh();
+
+    static const char* name(ScanBackend backend);
+
+    // The probe instance() uses
+    static bool probeSystem(ScanBackend backend);
+
+private:
+    // Callers hold mutex_
+    void ensureProbed() const;
+
+    Probe probe_;
+    mutable std::mutex mutex_;
+    mutable bool probed_ = false;
+    mutable std::vector<ScanBackend> available_;
+};
+
+} // namespace WifiScanner
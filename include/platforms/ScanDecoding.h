@@ -0,0 +1,59 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace WifiScanner {
+
+// What a BSS advertises about itself, collected either from its information
+// elements (nl80211) or from the matching blocks of `iw scan` output. AKM
+// suites and ciphers are bit sets indexed by their selector numbers
+// (00-0F-AC:n for RSN, 00-50-F2:n for WPA).
+struct BssCapabilities {
+    uint16_t capability = 0;   // Capability information field: ESS, IBSS, privacy
+    bool rsn = false;
+    bool wpa = false;
+    bool wps = false;
+    bool oweTransition = false;
+    bool mfpCapable = false;
+    bool mfpRequired = false;
+    uint32_t rsnAkms = 0;
+    uint32_t rsnCiphers = 0;
+    uint32_t wpaAkms = 0;
+    uint32_t wpaCiphers = 0;
+    int legacyRate = 0;        // Highest supported rate, 500 kb/s units
+    int htStreams = 0;
+    int vhtStreams = 0;
+    int heStreams = 0;
+    int width = 20;            // Operating channel width, MHz
+};
+
+// Set securityType, isEnterprise, PMF/WPS/OWE, channelWidth, maxDataRate and a
+// wpa_supplicant-style capabilities string ("[WPA2-PSK+SAE-CCMP][PMF][ESS]")
+void applyBssCapabilities(const BssCapabilities& bss, NetworkInfo& network);
+
+// Channel number of a 2.4, 5 or 6 GHz centre frequency; 0 for anything else
+int channelForFrequency(int frequency);
+
+// Back to a default NetworkInfo, keeping the string buffers for the next network
+void resetNetwork(NetworkInfo& network);
+
+// Helpers for single-pass text parsing
+
+// The next line of `text` at `position`, without its line ending; false at the end
+bool nextLine(std::string_view text, size_t& position, std::string_view& line);
+
+std::string_view trimLeft(std::string_view text);
+
+// Without leading blanks or trailing blanks and carriage returns
+std::string_view trim(std::string_view text);
+
+// Drop `prefix` from the front of `text` if it is there
+bool consumePrefix(std::string_view& text, std::string_view prefix);
+
+// The leading integer of `text` ("2437.0", "-45.00 dBm"); leaves `value` alone if there is none
+bool parseNumber(std::string_view text, int& value);
+
+} // namespace WifiScanner
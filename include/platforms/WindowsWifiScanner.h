@@ -19,6 +19,7 @@ public:
     WindowsWifiScanner();
     ~WindowsWifiScanner() override;
     
+    using WifiScanner::scan;
     std::vector<NetworkInfo> scan() override;
     bool isSupported() const override;
     std::string getPlatformName() const override;
@@ -1,16 +1,94 @@
 #include "CommandProcessor.h"
+#include "Tracing.h"
+#include "ComponentMatrix.h"
+#include "NetworkSnapshot.h"
+#include "SsidClassifier.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
 #include <iomanip>
+#include <fstream>
 
 namespace WifiScanner {
 
 const std::string CommandProcessor::PROMPT = "wifi-cli> ";
+const std::string CommandProcessor::PROFILE_FILE = "profiles.conf";
 
-CommandProcessor::CommandProcessor() {
-    scanner_ = createWifiScanner();
+namespace {
+
+// The columns shown for one network in the scan listing
+struct DisplayRow {
+    std::string ssid;
+    std::string bssid;
+    SecurityType securityType;
+    int signalStrength;
+    int channel;
+    std::string radios;
+};
+
+DisplayRow displayRow(const NetworkTable::Row& network) {
+    return {std::string(network.ssid().substr(0, 19)), std::string(network.bssid().substr(0, 17)), network.securityType(),
+            network.signalStrength(), network.channel(), std::string(network.radios())};
+}
+
+DisplayRow displayRow(const CompactNetwork& network) {
+    return {std::string(network.ssidView().substr(0, 19)), network.bssidString(), network.type(),
+            network.signalStrength, network.channel, std::string()};
+}
+
+// One page of the network table; false if there is nothing to show
+template <typename Networks>
+bool printNetworkTable(const Networks& networks, const std::vector<ScoreBreakdown>& breakdowns,
+                       size_t page, size_t perPage) {
+    if (networks.empty()) {
+        std::cout << "No networks to display." << std::endl;
+        return false;
+    }
+    
+    size_t startIndex = page * perPage;
+    size_t endIndex = std::min(startIndex + perPage, networks.size());
+    
+    std::cout << std::left << std::setw(20) << "SSID" 
+              << std::setw(18) << "BSSID"
+              << std::setw(15) << "Security"
+              << std::setw(10) << "Grade"
+              << std::setw(8) << "Signal"
+              << std::setw(8) << "Channel"
+              << "Radios"
+              << std::endl;
+    
+    std::cout << std::string(96, '-') << std::endl;
+    
+    for (size_t i = startIndex; i < endIndex; ++i) {
+        const DisplayRow row = displayRow(networks[i]);
+        std::cout << std::left << std::setw(20) << row.ssid
+                  << std::setw(18) << row.bssid
+                  << std::setw(15) << SecurityGrader::securityTypeToString(row.securityType).substr(0, 14)
+                  << std::setw(10) << SecurityGrader::gradeToString(breakdowns[i].grade).substr(0, 9)
+                  << std::setw(8) << row.signalStrength
+                  << std::setw(8) << row.channel
+                  << row.radios
+                  << std::endl;
+    }
+    return true;
+}
+
+} // namespace
+
+CommandProcessor::CommandProcessor() : CommandProcessor(createWifiScanner()) {
+}
+
+CommandProcessor::CommandProcessor(std::unique_ptr<WifiScanner> scanner)
+    : scanner_(std::move(scanner)), incrementalGrader_(grader_), activeProfile_(ProfileRegistry::DEFAULT_PROFILE) {
     currentPage_ = 0;
+    
+    if (std::ifstream(PROFILE_FILE)) {
+        try {
+            profiles_.loadFile(PROFILE_FILE);
+        } catch (const std::exception& e) {
+            std::cout << "Ignoring weight profiles: " << e.what() << std::endl;
+        }
+    }
 }
 
 void CommandProcessor::run() {
@@ -50,6 +128,16 @@ bool CommandProcessor::processCommand(const std::string& input) {
         return handleDeepScanCommand(args);
     } else if (command == "page" || command == "p") {
         return handlePageCommand(args);
+    } else if (command == "stats") {
+        return handleStatsCommand(args);
+    } else if (command == "profile") {
+        return handleProfileCommand(args);
+    } else if (command == "summary") {
+        return handleSummaryCommand(args);
+    } else if (command == "save") {
+        return handleSaveCommand(args);
+    } else if (command == "load") {
+        return handleLoadCommand(args);
     } else if (command == "help" || command == "h" || command == "?") {
         return handleHelpCommand(args);
     } else if (command == "version" || command == "v") {
@@ -64,7 +152,53 @@ bool CommandProcessor::processCommand(const std::string& input) {
 }
 
 bool CommandProcessor::handleScanCommand(const std::vector<std::string>& args) {
-    std::cout << "Scanning for Wi-Fi networks..." << std::endl;
+    // Each scan is graded with the profile it names, or the built-in weights
+    std::string profileName = ProfileRegistry::DEFAULT_PROFILE;
+    ScanRequest request = ScanRequest::full();
+    try {
+        for (size_t i = 1; i < args.size(); ++i) {
+            if ((args[i] == "--profile" || args[i] == "-p") && i + 1 < args.size()) {
+                profileName = args[++i];
+            } else if (args[i] == "cached") {
+                request.mode = ScanMode::CACHED;
+            } else if (args[i] == "full" || args[i] == "active") {
+                request.mode = ScanMode::ACTIVE;
+            } else if (args[i] == "band" && i + 1 < args.size()) {
+                const std::string& band = args[++i];
+                const WifiBand wifiBand = band == "2.4" ? WifiBand::BAND_2_4GHZ :
+                                          band == "5" ? WifiBand::BAND_5GHZ :
+                                          band == "6" ? WifiBand::BAND_6GHZ : WifiBand::OTHER;
+                if (wifiBand == WifiBand::OTHER) {
+                    throw std::runtime_error("Unknown band: " + band);
+                }
+                request.frequencies = ScanRequest::band(wifiBand).frequencies;
+            } else if ((args[i] == "channels" || args[i] == "ch") && i + 1 < args.size()) {
+                // Comma-separated: "1,6,11"
+                std::vector<int> channels;
+                std::istringstream list(args[++i]);
+                std::string channel;
+                while (std::getline(list, channel, ',')) {
+                    channels.push_back(std::stoi(channel));
+                }
+                request.frequencies = ScanRequest::channels(channels).frequencies;
+            } else {
+                throw std::runtime_error("Unexpected argument: " + args[i]);
+            }
+        }
+    } catch (const std::logic_error&) {
+        std::cout << "Channels must be numbers, e.g. scan channels 1,6,11" << std::endl;
+        return true;
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        std::cout << "Usage: scan [cached | full] [band <2.4|5|6> | channels <n,n,...>] [--profile <name>]" << std::endl;
+        return true;
+    }
+    if (!selectProfile(profileName)) {
+        std::cout << "Unknown profile: " << profileName << ". Type 'profile' to list profiles." << std::endl;
+        return true;
+    }
+    
+    std::cout << "Scanning for Wi-Fi networks (" << request.describe() << ")..." << std::endl;
     
     if (!scanner_ || !scanner_->isSupported()) {
         std::cout << "Wi-Fi scanning is not supported on this platform." << std::endl;
@@ -72,19 +206,37 @@ bool CommandProcessor::handleScanCommand(const std::vector<std::string>& args) {
     }
     
     try {
-        auto networks = scanner_->scan();
+        // The scanner decodes straight into a table on the scan arena, which
+        // drops the previous sweep in one reset
+        NetworkTable& networks = lastScan_.begin();
+        {
+            WIFI_TRACE_SCOPE(PLATFORM_SCAN);
+            WIFI_TRACE_COUNT(SCANS, 1);
+            scanner_->scanInto(networks, request);
+        }
         if (networks.empty()) {
+            lastScanBreakdowns_.clear();
             std::cout << "No networks found." << std::endl;
         } else {
-            std::cout << "Found " << networks.size() << " network(s):" << std::endl;
+            std::cout << "Found " << networks.size() << " network(s)";
+            if (activeProfile_ != ProfileRegistry::DEFAULT_PROFILE) {
+                std::cout << ", graded with profile '" << activeProfile_ << "'";
+            }
+            std::cout << ":" << std::endl;
             std::cout << std::endl;
             
-            // Grade and sort networks by security
-            lastScanResults_ = grader_.gradeAndSortNetworks(networks);
+            // Grade and sort networks by security, reusing grades of unchanged BSSIDs.
+            // The sorted copy is gathered on the same arena.
+            incrementalGrader_.update(networks);
+            networks = networks.select(incrementalGrader_.sortedRows());
+            lastScanBreakdowns_ = incrementalGrader_.sortedBreakdowns();
             currentPage_ = 0;
-            displayNetworks(lastScanResults_, currentPage_);
+            displayNetworks(lastScan_.table(), lastScanBreakdowns_, currentPage_);
         }
     } catch (const std::exception& e) {
+        // A failed sweep may have decoded part of a table; show none of it
+        lastScan_.begin();
+        lastScanBreakdowns_.clear();
         std::cout << "Error during scan: " << e.what() << std::endl;
     }
     
@@ -107,12 +259,12 @@ bool CommandProcessor::handleExitCommand(const std::vector<std::string>& args) {
 }
 
 bool CommandProcessor::handlePageCommand(const std::vector<std::string>& args) {
-    if (lastScanResults_.empty()) {
+    if (lastScan_.table().empty()) {
         std::cout << "No scan results available. Run 'scan' first." << std::endl;
         return true;
     }
     
-    size_t totalPages = (lastScanResults_.size() + NETWORKS_PER_PAGE - 1) / NETWORKS_PER_PAGE;
+    size_t totalPages = (lastScan_.table().size() + NETWORKS_PER_PAGE - 1) / NETWORKS_PER_PAGE;
     
     if (args.size() > 1) {
         try {
@@ -133,19 +285,188 @@ bool CommandProcessor::handlePageCommand(const std::vector<std::string>& args) {
         currentPage_ = (currentPage_ + 1) % totalPages;
     }
     
-    displayNetworks(lastScanResults_, currentPage_);
+    displayNetworks(lastScan_.table(), lastScanBreakdowns_, currentPage_);
+    return true;
+}
+
+bool CommandProcessor::handleStatsCommand(const std::vector<std::string>& args) {
+    if (!Tracing::compiledIn()) {
+        std::cout << "Tracing was disabled at build time (WIFI_SCANNER_TRACING=OFF)." << std::endl;
+        return true;
+    }
+    
+    if (args.size() > 1) {
+        std::string action = args[1];
+        std::transform(action.begin(), action.end(), action.begin(), ::tolower);
+        if (action == "on") {
+            Tracing::setEnabled(true);
+            std::cout << "Tracing enabled." << std::endl;
+        } else if (action == "off") {
+            Tracing::setEnabled(false);
+            std::cout << "Tracing disabled." << std::endl;
+        } else if (action == "reset") {
+            Tracing::reset();
+            std::cout << "Tracing statistics cleared." << std::endl;
+        } else {
+            std::cout << "Usage: stats [on|off|reset]" << std::endl;
+        }
+        return true;
+    }
+    
+    Tracing::Snapshot snapshot = Tracing::snapshot();
+    std::ios::fmtflags savedFlags = std::cout.flags();
+    std::streamsize savedPrecision = std::cout.precision();
+    std::cout << "Tracing: " << (Tracing::enabled() ? "on" : "off (use 'stats on')") << std::endl;
+    std::cout << std::endl;
+    
+    std::cout << std::left << std::setw(20) << "Stage" << std::right
+              << std::setw(10) << "Calls" << std::setw(14) << "Total (us)"
+              << std::setw(12) << "Avg (us)" << std::setw(12) << "Max (us)" << std::endl;
+    std::cout << std::string(68, '-') << std::endl;
+    for (size_t i = 0; i < Tracing::TIMER_COUNT; ++i) {
+        const Tracing::TimerStats& timer = snapshot.timers[i];
+        double avg = timer.calls ? timer.totalNanos / 1000.0 / timer.calls : 0.0;
+        std::cout << std::left << std::setw(20) << Tracing::timerName(static_cast<Tracing::Timer>(i)) << std::right
+                  << std::setw(10) << timer.calls
+                  << std::setw(14) << timer.totalNanos / 1000
+                  << std::setw(12) << std::fixed << std::setprecision(1) << avg
+                  << std::setw(12) << timer.maxNanos / 1000 << std::endl;
+    }
+    std::cout << std::endl;
+    
+    for (size_t i = 0; i < Tracing::COUNTER_COUNT; ++i) {
+        std::cout << std::left << std::setw(20) << Tracing::counterName(static_cast<Tracing::Counter>(i)) << std::right
+                  << std::setw(10) << snapshot.counters[i] << std::endl;
+    }
+    
+    std::cout.flags(savedFlags);
+    std::cout.precision(savedPrecision);
+    return true;
+}
+
+bool CommandProcessor::handleProfileCommand(const std::vector<std::string>& args) {
+    if (args.size() == 3 && args[1] == "load") {
+        try {
+            size_t loaded = profiles_.loadFile(args[2]);
+            std::cout << "Loaded " << loaded << " profile(s) from " << args[2] << "." << std::endl;
+        } catch (const std::exception& e) {
+            std::cout << "Error loading profiles: " << e.what() << std::endl;
+        }
+        return true;
+    }
+    
+    std::vector<std::string> names = profiles_.names();
+    names.insert(names.begin(), ProfileRegistry::DEFAULT_PROFILE);
+    
+    if (args.size() == 2 && args[1] == "compare") {
+        if (lastScan_.table().empty()) {
+            std::cout << "No scan results available. Run 'scan' first." << std::endl;
+            return true;
+        }
+        
+        // The stored breakdowns already hold every component, so nothing is rescored
+        ComponentMatrix matrix;
+        matrix.reserve(lastScanBreakdowns_.size());
+        for (const ScoreBreakdown& breakdown : lastScanBreakdowns_) {
+            matrix.append(breakdown);
+        }
+        // The default row uses the built-in double weights, matching `scan`;
+        // loaded profiles are scored in fixed point by the matrix
+        ProfileHistogram builtin;
+        builtin.profile = ProfileRegistry::DEFAULT_PROFILE;
+        for (const ScoreBreakdown& breakdown : lastScanBreakdowns_) {
+            const int score = SecurityGrader::builtinScore(breakdown);
+            ++builtin.grades[static_cast<size_t>(SecurityGrader::gradeFromScore(score))];
+            builtin.scoreSum += static_cast<uint64_t>(score);
+            ++builtin.networks;
+        }
+        std::vector<WeightProfile> candidates;
+        for (const std::string& name : profiles_.names()) {
+            candidates.push_back(profiles_.find(name)->profile());
+        }
+        std::vector<ProfileHistogram> histograms = matrix.scoreProfiles(candidates);
+        histograms.insert(histograms.begin(), std::move(builtin));
+        
+        std::ios::fmtflags savedFlags = std::cout.flags();
+        std::streamsize savedPrecision = std::cout.precision();
+        std::cout << std::left << std::setw(16) << "Profile" << std::right
+                  << std::setw(11) << "Excellent" << std::setw(7) << "Good" << std::setw(7) << "Okay"
+                  << std::setw(7) << "Bad" << std::setw(10) << "Very Bad" << std::setw(8) << "Mean" << std::endl;
+        std::cout << std::string(66, '-') << std::endl;
+        for (const ProfileHistogram& histogram : histograms) {
+            std::cout << std::left << std::setw(16) << histogram.profile << std::right
+                      << std::setw(11) << histogram.count(SecurityGrade::EXCELLENT)
+                      << std::setw(7) << histogram.count(SecurityGrade::GOOD)
+                      << std::setw(7) << histogram.count(SecurityGrade::OKAY)
+                      << std::setw(7) << histogram.count(SecurityGrade::BAD)
+                      << std::setw(10) << histogram.count(SecurityGrade::VERY_BAD)
+                      << std::setw(8) << std::fixed << std::setprecision(1) << histogram.meanScore() << std::endl;
+        }
+        std::cout.flags(savedFlags);
+        std::cout.precision(savedPrecision);
+        return true;
+    }
+    if (args.size() != 1) {
+        std::cout << "Usage: profile [load <file> | compare]" << std::endl;
+        return true;
+    }
+    
+    std::ios::fmtflags savedFlags = std::cout.flags();
+    std::streamsize savedPrecision = std::cout.precision();
+    std::cout << std::left << std::setw(16) << "Profile" << std::right
+              << std::setw(7) << "Enc" << std::setw(7) << "Auth" << std::setw(7) << "Chan"
+              << std::setw(7) << "Feat" << std::setw(7) << "Conf" << std::setw(7) << "Vend"
+              << std::setw(7) << "Adv" << "  Grades (E/G/O/B)" << std::endl;
+    std::cout << std::string(83, '-') << std::endl;
+    for (const std::string& name : names) {
+        auto evaluator = profiles_.find(name);
+        const WeightProfile profile = evaluator ? evaluator->profile() : WeightProfile{};
+        std::cout << std::left << std::setw(16) << (name == activeProfile_ ? name + " *" : name) << std::right
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(7) << profile.encryption << std::setw(7) << profile.authentication
+                  << std::setw(7) << profile.channel << std::setw(7) << profile.feature
+                  << std::setw(7) << profile.configuration << std::setw(7) << profile.vendor
+                  << std::setw(7) << profile.advanced << "  " << profile.excellent << "/" << profile.good
+                  << "/" << profile.okay << "/" << profile.bad << std::endl;
+    }
+    std::cout << "* used by the last scan" << std::endl;
+    
+    std::cout.flags(savedFlags);
+    std::cout.precision(savedPrecision);
+    return true;
+}
+
+bool CommandProcessor::selectProfile(const std::string& name) {
+    // Profile names are case-insensitive, including the built-in one
+    std::string lowerName = name;
+    std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
+    
+    std::shared_ptr<const ProfileEvaluator> evaluator;
+    if (lowerName != ProfileRegistry::DEFAULT_PROFILE) {
+        evaluator = profiles_.find(name);
+        if (!evaluator) {
+            return false;
+        }
+    }
+    
+    // Stored grades belong to the previous profile, so switching regrades everything once
+    if (evaluator.get() != grader_.profile()) {
+        grader_.setProfile(evaluator);
+        incrementalGrader_.clear();
+    }
+    activeProfile_ = evaluator ? evaluator->name() : std::string(ProfileRegistry::DEFAULT_PROFILE);
     return true;
 }
 
 bool CommandProcessor::handleDeepScanCommand(const std::vector<std::string>& args) {
-    if (lastScanResults_.empty()) {
+    if (lastScan_.table().empty()) {
         std::cout << "No scan results available. Run 'scan' first." << std::endl;
         return true;
     }
     
     if (args.size() < 2) {
         std::cout << "Usage: dscan <network_number> [test_type]" << std::endl;
-        std::cout << "  network_number: Index of network to analyze (0-" << (lastScanResults_.size() - 1) << ")" << std::endl;
+        std::cout << "  network_number: Index of network to analyze (0-" << (lastScan_.table().size() - 1) << ")" << std::endl;
         std::cout << "  test_type: security, performance, threats, or all (default: all)" << std::endl;
         std::cout << std::endl;
         std::cout << "Examples:" << std::endl;
@@ -157,20 +478,21 @@ bool CommandProcessor::handleDeepScanCommand(const std::vector<std::string>& arg
     
     try {
         size_t networkIndex = std::stoul(args[1]);
-        if (networkIndex >= lastScanResults_.size()) {
+        if (networkIndex >= lastScan_.table().size()) {
             std::cout << "Network " << networkIndex << " does not exist. ";
-            std::cout << "Available networks: 0-" << (lastScanResults_.size() - 1) << std::endl;
+            std::cout << "Available networks: 0-" << (lastScan_.table().size() - 1) << std::endl;
             return true;
         }
         
-        const NetworkInfo& network = lastScanResults_[networkIndex];
+        const NetworkInfo network = lastScan_.table()[networkIndex].toNetworkInfo();
+        const ScoreBreakdown& breakdown = lastScanBreakdowns_[networkIndex];
         std::string testType = (args.size() > 2) ? args[2] : "all";
         
         std::cout << "🔍 Deep Scanning Network " << networkIndex << "..." << std::endl;
         std::cout << "==========================================" << std::endl;
         
         if (testType == "all" || testType == "security") {
-            performSecurityAnalysis(network);
+            performSecurityAnalysis(network, breakdown);
         }
         
         if (testType == "all" || testType == "performance") {
@@ -182,7 +504,7 @@ bool CommandProcessor::handleDeepScanCommand(const std::vector<std::string>& arg
         }
         
         if (testType == "all") {
-            performVulnerabilityAssessment(network);
+            performVulnerabilityAssessment(network, breakdown);
         }
         
     } catch (const std::exception& e) {
@@ -192,20 +514,123 @@ bool CommandProcessor::handleDeepScanCommand(const std::vector<std::string>& arg
     return true;
 }
 
+bool CommandProcessor::handleSummaryCommand(const std::vector<std::string>&) {
+    if (lastScan_.table().empty()) {
+        std::cout << "No scan results available. Run 'scan' first." << std::endl;
+        return true;
+    }
+    
+    // Each figure reads a single column of the table
+    const SignalStats signal = lastScan_.table().signalStats();
+    std::ios::fmtflags savedFlags = std::cout.flags();
+    std::streamsize savedPrecision = std::cout.precision();
+    std::cout << "Networks: " << lastScan_.table().size() << std::endl;
+    std::cout << "Signal: " << signal.min << " to " << signal.max << " dBm, mean "
+              << std::fixed << std::setprecision(1) << signal.mean << " dBm" << std::endl;
+    std::cout.flags(savedFlags);
+    std::cout.precision(savedPrecision);
+    
+    std::cout << std::endl << "By band:" << std::endl;
+    const std::pair<WifiBand, const char*> bands[] = {
+        {WifiBand::BAND_2_4GHZ, "2.4 GHz"}, {WifiBand::BAND_5GHZ, "5 GHz"},
+        {WifiBand::BAND_6GHZ, "6 GHz"}, {WifiBand::OTHER, "Other"}
+    };
+    for (const auto& band : bands) {
+        const size_t count = lastScan_.table().rowsInBand(band.first).size();
+        if (count > 0) {
+            std::cout << "  " << std::left << std::setw(18) << band.second << count << std::endl;
+        }
+    }
+    
+    std::cout << std::endl << "By security type:" << std::endl;
+    const std::array<size_t, 8> types = lastScan_.table().countBySecurityType();
+    for (size_t type = 0; type < types.size(); ++type) {
+        if (types[type] > 0) {
+            std::cout << "  " << std::left << std::setw(18)
+                      << SecurityGrader::securityTypeToString(static_cast<SecurityType>(type)) << types[type] << std::endl;
+        }
+    }
+    std::cout.flags(savedFlags);
+    return true;
+}
+
+bool CommandProcessor::handleSaveCommand(const std::vector<std::string>& args) {
+    if (args.size() != 2) {
+        std::cout << "Usage: save <file>" << std::endl;
+        return true;
+    }
+    if (lastScan_.table().empty()) {
+        std::cout << "No scan results available. Run 'scan' first." << std::endl;
+        return true;
+    }
+    
+    try {
+        saveSnapshot(lastScan_.table(), args[1]);
+        std::cout << "Saved " << lastScan_.table().size() << " network(s) to " << args[1] << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "Error saving snapshot: " << e.what() << std::endl;
+    }
+    return true;
+}
+
+bool CommandProcessor::handleLoadCommand(const std::vector<std::string>& args) {
+    if (args.size() != 2) {
+        std::cout << "Usage: load <file>" << std::endl;
+        return true;
+    }
+    
+    try {
+        // Regraded with the active profile, so a snapshot reads like a fresh scan
+        const SnapshotTable snapshot(args[1]);
+        NetworkTable& results = lastScan_.begin();
+        results = grader_.gradeAndSortNetworks(snapshot.toNetworkTable(results.resource()));
+        lastScanBreakdowns_.clear();
+        lastScanBreakdowns_.reserve(lastScan_.table().size());
+        {
+            WIFI_TRACE_SCOPE(SCORE_BREAKDOWNS);
+            for (size_t i = 0; i < lastScan_.table().size(); ++i) {
+                lastScanBreakdowns_.push_back(grader_.scoreBreakdown(lastScan_.table()[i]));
+            }
+        }
+        currentPage_ = 0;
+        
+        std::cout << "Loaded " << lastScan_.table().size() << " network(s) from " << args[1] << ":" << std::endl;
+        std::cout << std::endl;
+        if (!lastScan_.table().empty()) {
+            displayNetworks(lastScan_.table(), lastScanBreakdowns_, currentPage_);
+        }
+    } catch (const std::exception& e) {
+        std::cout << "Error loading snapshot: " << e.what() << std::endl;
+    }
+    return true;
+}
+
 void CommandProcessor::showHelp() const {
     std::cout << "Available commands:" << std::endl;
-    std::cout << "  scan, s     - Scan for nearby Wi-Fi networks" << std::endl;
+    std::cout << "  scan, s     - Scan for nearby Wi-Fi networks (scan [cached] [band <2.4|5|6> | channels <list>] [--profile <name>])" << std::endl;
     std::cout << "  dscan, ds   - Deep scan specific network for detailed analysis" << std::endl;
     std::cout << "  page, p     - Navigate through scan results (page <number>)" << std::endl;
+    std::cout << "  stats       - Show grading timings and counters (stats on|off|reset)" << std::endl;
+    std::cout << "  profile     - List weight profiles (profile load <file> | compare)" << std::endl;
+    std::cout << "  summary     - Count the last scan by band and security type" << std::endl;
+    std::cout << "  save        - Write the last scan to a snapshot file (save <file>)" << std::endl;
+    std::cout << "  load        - Show a saved snapshot as the current scan (load <file>)" << std::endl;
     std::cout << "  help, h, ?  - Show this help message" << std::endl;
     std::cout << "  version, v  - Show version information" << std::endl;
     std::cout << "  exit, quit, q - Exit the application" << std::endl;
     std::cout << std::endl;
     std::cout << "Examples:" << std::endl;
     std::cout << "  " << PROMPT << "scan" << std::endl;
+    std::cout << "  " << PROMPT << "scan --profile corporate" << std::endl;
+    std::cout << "  " << PROMPT << "scan cached" << std::endl;
+    std::cout << "  " << PROMPT << "scan channels 1,6,11" << std::endl;
+    std::cout << "  " << PROMPT << "profile compare" << std::endl;
     std::cout << "  " << PROMPT << "dscan 0" << std::endl;
     std::cout << "  " << PROMPT << "ds 5 security" << std::endl;
     std::cout << "  " << PROMPT << "page 2" << std::endl;
+    std::cout << "  " << PROMPT << "stats on" << std::endl;
+    std::cout << "  " << PROMPT << "summary" << std::endl;
+    std::cout << "  " << PROMPT << "save office.snap" << std::endl;
 }
 
 void CommandProcessor::showVersion() const {
@@ -227,50 +652,37 @@ std::vector<std::string> CommandProcessor::parseCommand(const std::string& input
     return args;
 }
 
-void CommandProcessor::displayNetworks(const std::vector<NetworkInfo>& networks, size_t page) const {
-    if (networks.empty()) {
-        std::cout << "No networks to display." << std::endl;
-        return;
+void CommandProcessor::displayNetworks(const NetworkTable& networks,
+                                       const std::vector<ScoreBreakdown>& breakdowns, size_t page) const {
+    if (printNetworkTable(networks, breakdowns, page, NETWORKS_PER_PAGE)) {
+        showPageNavigation(page, (networks.size() + NETWORKS_PER_PAGE - 1) / NETWORKS_PER_PAGE);
     }
-    
-    size_t totalPages = (networks.size() + NETWORKS_PER_PAGE - 1) / NETWORKS_PER_PAGE;
-    size_t startIndex = page * NETWORKS_PER_PAGE;
-    size_t endIndex = std::min(startIndex + NETWORKS_PER_PAGE, networks.size());
-    
-    std::cout << std::left << std::setw(20) << "SSID" 
-              << std::setw(18) << "BSSID"
-              << std::setw(15) << "Security"
-              << std::setw(10) << "Grade"
-              << std::setw(8) << "Signal"
-              << std::setw(8) << "Channel"
-              << std::endl;
-    
-    std::cout << std::string(80, '-') << std::endl;
-    
-    for (size_t i = startIndex; i < endIndex; ++i) {
-        const auto& network = networks[i];
-        std::cout << std::left << std::setw(20) << network.ssid.substr(0, 19)
-                  << std::setw(18) << network.bssid.substr(0, 17)
-                  << std::setw(15) << SecurityGrader::securityTypeToString(network.securityType).substr(0, 14)
-                  << std::setw(10) << SecurityGrader::gradeToString(grader_.gradeNetwork(network)).substr(0, 9)
-                  << std::setw(8) << network.signalStrength
-                  << std::setw(8) << network.channel
-                  << std::endl;
+}
+
+void CommandProcessor::displayNetworks(const std::vector<CompactNetwork>& networks,
+                                       const std::vector<ScoreBreakdown>& breakdowns, size_t page) const {
+    if (printNetworkTable(networks, breakdowns, page, NETWORKS_PER_PAGE)) {
+        showPageNavigation(page, (networks.size() + NETWORKS_PER_PAGE - 1) / NETWORKS_PER_PAGE);
     }
-    
-    showPageNavigation(page, totalPages);
 }
 
-void CommandProcessor::displayNetworkDetails(const NetworkInfo& network) const {
+void CommandProcessor::displayNetworkDetails(const CompactNetwork& network, const ScoreBreakdown& breakdown) const {
+    displayNetworkDetails(network.toNetworkInfo(), breakdown);
+}
+
+void CommandProcessor::displayNetworkDetails(const NetworkInfo& network, const ScoreBreakdown& breakdown) const {
     std::cout << "Network Details:" << std::endl;
     std::cout << "  SSID: " << network.ssid << std::endl;
     std::cout << "  BSSID: " << network.bssid << std::endl;
     std::cout << "  Security: " << SecurityGrader::securityTypeToString(network.securityType) << std::endl;
-    std::cout << "  Grade: " << SecurityGrader::gradeToString(grader_.gradeNetwork(network)) << std::endl;
+    std::cout << "  Grade: " << SecurityGrader::gradeToString(breakdown.grade) << std::endl;
     std::cout << "  Signal Strength: " << network.signalStrength << " dBm" << std::endl;
     std::cout << "  Channel: " << network.channel << std::endl;
     std::cout << "  Frequency: " << network.frequency << " MHz" << std::endl;
     std::cout << "  Hidden: " << (network.isHidden ? "Yes" : "No") << std::endl;
+    if (!network.radios.empty()) {
+        std::cout << "  Radios: " << network.radios << std::endl;
+    }
     if (!network.capabilities.empty()) {
         std::cout << "  Capabilities: " << network.capabilities << std::endl;
     }
@@ -294,14 +706,24 @@ void CommandProcessor::showPageNavigation(size_t currentPage, size_t totalPages)
     std::cout << std::endl;
 }
 
-void CommandProcessor::performSecurityAnalysis(const NetworkInfo& network) const {
+void CommandProcessor::performSecurityAnalysis(const NetworkInfo& network, const ScoreBreakdown& breakdown) const {
     std::cout << "🔒 SECURITY ANALYSIS" << std::endl;
     std::cout << "===================" << std::endl;
     
     // Basic security info
     std::cout << "Protocol: " << SecurityGrader::securityTypeToString(network.securityType) << std::endl;
-    std::cout << "Grade: " << SecurityGrader::gradeToString(grader_.gradeNetwork(network)) << std::endl;
-    std::cout << "Score: " << grader_.getCachedScore(network) << "/100" << std::endl;
+    std::cout << "Grade: " << SecurityGrader::gradeToString(breakdown.grade) << std::endl;
+    std::cout << "Score: " << breakdown.score << "/100" << std::endl;
+    
+    // Unweighted component scores from the scan-time breakdown
+    std::cout << "Score Components:" << std::endl;
+    std::cout << "  Encryption: " << breakdown.encryption << " (35%)" << std::endl;
+    std::cout << "  Authentication: " << breakdown.authentication << " (15%)" << std::endl;
+    std::cout << "  Channel: " << breakdown.channel << " (10%)" << std::endl;
+    std::cout << "  Features: " << breakdown.feature << " (20%)" << std::endl;
+    std::cout << "  Configuration: " << breakdown.configuration << " (10%)" << std::endl;
+    std::cout << "  Vendor: " << breakdown.vendor << " (5%)" << std::endl;
+    std::cout << "  Advanced: " << breakdown.advanced << " (5%)" << std::endl;
     
     // Security features
     std::cout << "Features:" << std::endl;
@@ -367,6 +789,9 @@ void CommandProcessor::performThreatAnalysis(const NetworkInfo& network) const {
     std::cout << "  Evil Twin: " << (network.isEvilTwin ? "🚨 DETECTED" : "✅ None detected") << std::endl;
     std::cout << "  Typo Squatting: " << (network.isTypoSquatting ? "🚨 DETECTED" : "✅ None detected") << std::endl;
     std::cout << "  Anomalous Behavior: " << (network.hasAnomalousBehavior ? "🚨 DETECTED" : "✅ None detected") << std::endl;
+    std::cout << "  SSID Watchlist: "
+              << (SsidClassifier::instance().matches(network.ssid, SsidCategory::WATCHLIST) ? "🚨 MATCHED" : "✅ No match")
+              << std::endl;
     
     // Security risks
     std::cout << "Security Risks:" << std::endl;
@@ -388,11 +813,11 @@ void CommandProcessor::performThreatAnalysis(const NetworkInfo& network) const {
     std::cout << std::endl;
 }
 
-void CommandProcessor::performVulnerabilityAssessment(const NetworkInfo& network) const {
+void CommandProcessor::performVulnerabilityAssessment(const NetworkInfo& network, const ScoreBreakdown& breakdown) const {
     std::cout << "🔍 VULNERABILITY ASSESSMENT" << std::endl;
     std::cout << "==========================" << std::endl;
     
-    int score = grader_.getCachedScore(network);
+    int score = breakdown.score;
     
     // Overall risk assessment
     std::cout << "Risk Level: ";
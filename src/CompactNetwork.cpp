@@ -0,0 +1,149 @@
+#include "CompactNetwork.h"
+#include "VendorRegistry.h"
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace WifiScanner {
+
+namespace {
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Parses "xx:xx:xx:xx:xx:xx"; `upper` reports the letter case, and mixed case is rejected
+bool parseBssid(const std::string& text, uint64_t& value, bool& upper) {
+    if (text.size() != 17) {
+        return false;
+    }
+    bool sawLower = false;
+    bool sawUpper = false;
+    value = 0;
+    for (size_t octet = 0; octet < 6; ++octet) {
+        const char high = text[octet * 3];
+        const char low = text[octet * 3 + 1];
+        if (octet < 5 && text[octet * 3 + 2] != ':') {
+            return false;
+        }
+        for (char c : {high, low}) {
+            if (hexValue(c) < 0) return false;
+            sawLower |= c >= 'a' && c <= 'f';
+            sawUpper |= c >= 'A' && c <= 'F';
+        }
+        value = (value << 8) | static_cast<uint64_t>(hexValue(high) << 4 | hexValue(low));
+    }
+    upper = sawUpper;
+    return !(sawLower && sawUpper);
+}
+
+template <typename T>
+bool fits(int value) {
+    return value >= std::numeric_limits<T>::min() && value <= std::numeric_limits<T>::max();
+}
+
+} // namespace
+
+CompactNetwork::CompactNetwork()
+    : ssid{}, bssid(0), ssidLength(0), securityType(static_cast<uint64_t>(SecurityType::UNKNOWN)),
+      hasBssid(0), upperCaseBssid(0), flags(0), signalStrength(0), channel(0), frequency(0),
+      channelWidth(20), maxDataRate(0), beaconInterval(100), vendorId(0), capabilitiesId(0) {
+}
+
+StringPool& CompactNetwork::capabilityPool() {
+    static StringPool pool(std::numeric_limits<uint16_t>::max() + size_t(1));
+    return pool;
+}
+
+bool CompactNetwork::tryFromNetworkInfo(const NetworkInfo& network, CompactNetwork& compact) {
+    const int type = static_cast<int>(network.securityType);
+    if (network.ssid.size() > MAX_SSID_LENGTH || !network.radios.empty() || type < 0 || type > static_cast<int>(SecurityType::UNKNOWN) ||
+        !fits<int8_t>(network.signalStrength) || !fits<uint8_t>(network.channel) ||
+        !fits<uint16_t>(network.frequency) || !fits<uint16_t>(network.channelWidth) ||
+        !fits<uint16_t>(network.maxDataRate) || !fits<uint16_t>(network.beaconInterval)) {
+        return false;
+    }
+
+    uint64_t mac = 0;
+    bool upper = false;
+    if (!network.bssid.empty() && !parseBssid(network.bssid, mac, upper)) {
+        return false;
+    }
+
+    uint16_t vendor = network.vendorId;
+    if (vendor == VendorRegistry::NO_VENDOR) {
+        vendor = VendorRegistry::instance().intern(network.vendor);
+        if (vendor == VendorRegistry::NO_VENDOR && !network.vendor.empty()) {
+            return false;
+        }
+    }
+    const uint16_t capabilities = capabilityPool().intern(network.capabilities);
+    if (capabilities == StringPool::NONE && !network.capabilities.empty()) {
+        return false;
+    }
+
+    CompactNetwork result;
+    std::memcpy(result.ssid, network.ssid.data(), network.ssid.size());
+    result.ssidLength = network.ssid.size();
+    result.bssid = mac;
+    result.hasBssid = !network.bssid.empty();
+    result.upperCaseBssid = upper;
+    result.securityType = static_cast<uint64_t>(type);
+    result.flags = static_cast<uint16_t>(packNetworkFlags(network));
+    result.signalStrength = static_cast<int8_t>(network.signalStrength);
+    result.channel = static_cast<uint8_t>(network.channel);
+    result.frequency = static_cast<uint16_t>(network.frequency);
+    result.channelWidth = static_cast<uint16_t>(network.channelWidth);
+    result.maxDataRate = static_cast<uint16_t>(network.maxDataRate);
+    result.beaconInterval = static_cast<uint16_t>(network.beaconInterval);
+    result.vendorId = vendor;
+    result.capabilitiesId = capabilities;
+    compact = result;
+    return true;
+}
+
+CompactNetwork CompactNetwork::fromNetworkInfo(const NetworkInfo& network) {
+    CompactNetwork compact;
+    if (!tryFromNetworkInfo(network, compact)) {
+        throw std::invalid_argument("network '" + network.ssid + "' (" + network.bssid +
+                                    ") has no compact representation");
+    }
+    return compact;
+}
+
+NetworkInfo CompactNetwork::toNetworkInfo() const {
+    NetworkInfo network;
+    network.ssid.assign(ssid, ssidLength);
+    network.bssid = bssidString();
+    network.securityType = type();
+    network.signalStrength = signalStrength;
+    network.channel = channel;
+    network.frequency = frequency;
+    network.capabilities = capabilityPool().lookup(capabilitiesId);
+    network.channelWidth = channelWidth;
+    network.maxDataRate = maxDataRate;
+    network.vendor = VendorRegistry::instance().name(vendorId);
+    network.vendorId = vendorId;
+    network.beaconInterval = beaconInterval;
+    unpackNetworkFlags(flags, network);
+    return network;
+}
+
+std::string CompactNetwork::bssidString() const {
+    if (!hasBssid) {
+        return std::string();
+    }
+    const char* digits = upperCaseBssid ? "0123456789ABCDEF" : "0123456789abcdef";
+    std::string text(17, ':');
+    for (int octet = 0; octet < 6; ++octet) {
+        const unsigned value = static_cast<unsigned>(bssid >> (40 - 8 * octet)) & 0xFF;
+        text[octet * 3] = digits[value >> 4];
+        text[octet * 3 + 1] = digits[value & 0xF];
+    }
+    return text;
+}
+
+} // namespace WifiScanner
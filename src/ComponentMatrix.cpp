@@ -0,0 +1,233 @@
+#include "ComponentMatrix.h"
+#include "ThreadPool.h"
+#include "Tracing.h"
+#include <algorithm>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define WIFI_SCANNER_X86_SIMD 1
+#include <immintrin.h>
+#define WIFI_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace WifiScanner {
+
+namespace {
+
+struct Columns {
+    const int32_t* encryption;
+    const int32_t* authentication;
+    const int32_t* channel;
+    const int32_t* feature;
+    const int32_t* configuration;
+    const int32_t* vendor;
+    const int32_t* advanced;
+};
+
+// One profile ready for the kernels
+struct CompiledProfile {
+    ProfileEvaluator::FixedWeights weights;
+    int thresholds[4];  // Lowest BAD, OKAY, GOOD, EXCELLENT score
+};
+
+// Per-profile running totals; atLeast[k] counts scores >= thresholds[k]
+struct Accumulator {
+    uint64_t atLeast[4] = {};
+    uint64_t scoreSum = 0;
+};
+
+void accumulateScalar(const Columns& c, size_t begin, size_t end, const CompiledProfile& p, Accumulator& acc) {
+    const ProfileEvaluator::FixedWeights& w = p.weights;
+    for (size_t i = begin; i < end; ++i) {
+        int64_t total = static_cast<int64_t>(c.encryption[i]) * w.encryption;
+        total += static_cast<int64_t>(c.authentication[i]) * w.authentication;
+        total += static_cast<int64_t>(c.channel[i]) * w.channel;
+        total += static_cast<int64_t>(c.feature[i]) * w.feature;
+        total += static_cast<int64_t>(c.configuration[i]) * w.configuration;
+        total += static_cast<int64_t>(c.vendor[i]) * w.vendor;
+        total += static_cast<int64_t>(c.advanced[i]) * w.advanced;
+        total = std::max<int64_t>(0, std::min<int64_t>(100 * ProfileEvaluator::SCALE, total));
+        const int score = static_cast<int>((total + ProfileEvaluator::SCALE / 2) / ProfileEvaluator::SCALE);
+
+        acc.scoreSum += score;
+        for (int k = 0; k < 4; ++k) {
+            acc.atLeast[k] += score >= p.thresholds[k];
+        }
+    }
+}
+
+#ifdef WIFI_SCANNER_X86_SIMD
+
+WIFI_TARGET("avx2") inline __m256i load256(const int32_t* column, size_t i) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column + i));
+}
+
+WIFI_TARGET("avx2") inline uint64_t sumLanes256(__m256i v) {
+    alignas(32) int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), v);
+    uint64_t sum = 0;
+    for (int32_t lane : lanes) {
+        sum += static_cast<uint32_t>(lane);
+    }
+    return sum;
+}
+
+// Eight rows per iteration; returns the first row left for the scalar loop.
+// Per-lane counters cannot overflow within one block.
+WIFI_TARGET("avx2") size_t accumulateAvx2(const Columns& c, size_t begin, size_t end,
+                                          const CompiledProfile& p, Accumulator& acc) {
+    const ProfileEvaluator::FixedWeights& w = p.weights;
+    const __m256i wEnc = _mm256_set1_epi32(w.encryption);
+    const __m256i wAuth = _mm256_set1_epi32(w.authentication);
+    const __m256i wChan = _mm256_set1_epi32(w.channel);
+    const __m256i wFeat = _mm256_set1_epi32(w.feature);
+    const __m256i wConf = _mm256_set1_epi32(w.configuration);
+    const __m256i wVend = _mm256_set1_epi32(w.vendor);
+    const __m256i wAdv = _mm256_set1_epi32(w.advanced);
+    const __m256i limit = _mm256_set1_epi32(100 * ProfileEvaluator::SCALE);
+    const __m256i half = _mm256_set1_epi32(ProfileEvaluator::SCALE / 2);
+    const __m256 scale = _mm256_set1_ps(ProfileEvaluator::SCALE);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i below[4];
+    for (int k = 0; k < 4; ++k) {
+        below[k] = _mm256_set1_epi32(p.thresholds[k] - 1);
+    }
+
+    __m256i sum = zero;
+    __m256i counts[4] = {zero, zero, zero, zero};
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256i total = _mm256_mullo_epi32(load256(c.encryption, i), wEnc);
+        total = _mm256_add_epi32(total, _mm256_mullo_epi32(load256(c.authentication, i), wAuth));
+        total = _mm256_add_epi32(total, _mm256_mullo_epi32(load256(c.channel, i), wChan));
+        total = _mm256_add_epi32(total, _mm256_mullo_epi32(load256(c.feature, i), wFeat));
+        total = _mm256_add_epi32(total, _mm256_mullo_epi32(load256(c.configuration, i), wConf));
+        total = _mm256_add_epi32(total, _mm256_mullo_epi32(load256(c.vendor, i), wVend));
+        total = _mm256_add_epi32(total, _mm256_mullo_epi32(load256(c.advanced, i), wAdv));
+        total = _mm256_add_epi32(_mm256_max_epi32(zero, _mm256_min_epi32(total, limit)), half);
+        // Exact floor division, see combineFixed256() in SecurityGraderBatch.cpp
+        const __m256i score = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(total), scale));
+
+        sum = _mm256_add_epi32(sum, score);
+        for (int k = 0; k < 4; ++k) {
+            counts[k] = _mm256_sub_epi32(counts[k], _mm256_cmpgt_epi32(score, below[k]));
+        }
+    }
+
+    acc.scoreSum += sumLanes256(sum);
+    for (int k = 0; k < 4; ++k) {
+        acc.atLeast[k] += sumLanes256(counts[k]);
+    }
+    return i;
+}
+
+#endif // WIFI_SCANNER_X86_SIMD
+
+} // namespace
+
+ComponentMatrix::ComponentMatrix(const SecurityGrader& grader, const std::vector<NetworkInfo>& networks) {
+    WIFI_TRACE_SCOPE(SCORE_BREAKDOWNS);
+    reserve(networks.size());
+    for (const auto& network : networks) {
+        append(grader.scoreBreakdown(network));
+    }
+}
+
+void ComponentMatrix::append(const ScoreBreakdown& components) {
+    encryption_.push_back(components.encryption);
+    authentication_.push_back(components.authentication);
+    channel_.push_back(components.channel);
+    feature_.push_back(components.feature);
+    configuration_.push_back(components.configuration);
+    vendor_.push_back(components.vendor);
+    advanced_.push_back(components.advanced);
+}
+
+void ComponentMatrix::reserve(size_t count) {
+    encryption_.reserve(count);
+    authentication_.reserve(count);
+    channel_.reserve(count);
+    feature_.reserve(count);
+    configuration_.reserve(count);
+    vendor_.reserve(count);
+    advanced_.reserve(count);
+}
+
+void ComponentMatrix::clear() {
+    encryption_.clear();
+    authentication_.clear();
+    channel_.clear();
+    feature_.clear();
+    configuration_.clear();
+    vendor_.clear();
+    advanced_.clear();
+}
+
+std::vector<ProfileHistogram> ComponentMatrix::scoreProfiles(const std::vector<WeightProfile>& profiles,
+                                                             ExecutionPolicy policy) const {
+    return scoreProfiles(profiles, policy, SecurityGrader::detectSimdLevel());
+}
+
+std::vector<ProfileHistogram> ComponentMatrix::scoreProfiles(const std::vector<WeightProfile>& profiles,
+                                                             ExecutionPolicy policy, SimdLevel level) const {
+    WIFI_TRACE_SCOPE(SCORE_PROFILES);
+    std::vector<CompiledProfile> compiled;
+    compiled.reserve(profiles.size());
+    for (const WeightProfile& profile : profiles) {
+        compiled.push_back({ProfileEvaluator(profile).weights(),
+                            {profile.bad, profile.okay, profile.good, profile.excellent}});
+    }
+
+    const Columns columns = {encryption_.data(), authentication_.data(), channel_.data(), feature_.data(),
+                             configuration_.data(), vendor_.data(), advanced_.data()};
+    const bool useAvx2 = level == SimdLevel::AVX2 && SecurityGrader::detectSimdLevel() == SimdLevel::AVX2;
+
+    const size_t count = size();
+    size_t threads = policy.threads == 0 ? ThreadPool::hardwareThreads() : policy.threads;
+    threads = std::max<size_t>(1, std::min(threads, count / SecurityGrader::MIN_PARALLEL_CHUNK));
+
+    // Each chunk walks its rows block by block, scoring every block against
+    // every profile while the block's columns are still in cache
+    std::vector<std::vector<Accumulator>> partials(threads, std::vector<Accumulator>(compiled.size()));
+    ThreadPool::shared().parallelFor(threads, [&](size_t chunk) {
+        const size_t chunkBegin = count * chunk / threads;
+        const size_t chunkEnd = count * (chunk + 1) / threads;
+        std::vector<Accumulator>& accumulators = partials[chunk];
+
+        for (size_t begin = chunkBegin; begin < chunkEnd; begin += BLOCK_ROWS) {
+            const size_t end = std::min(begin + BLOCK_ROWS, chunkEnd);
+            for (size_t p = 0; p < compiled.size(); ++p) {
+                size_t done = begin;
+#ifdef WIFI_SCANNER_X86_SIMD
+                if (useAvx2) {
+                    done = accumulateAvx2(columns, begin, end, compiled[p], accumulators[p]);
+                }
+#endif
+                accumulateScalar(columns, done, end, compiled[p], accumulators[p]);
+            }
+        }
+    });
+
+    std::vector<ProfileHistogram> histograms(profiles.size());
+    for (size_t p = 0; p < profiles.size(); ++p) {
+        Accumulator total;
+        for (const auto& partial : partials) {
+            for (int k = 0; k < 4; ++k) {
+                total.atLeast[k] += partial[p].atLeast[k];
+            }
+            total.scoreSum += partial[p].scoreSum;
+        }
+
+        ProfileHistogram& histogram = histograms[p];
+        histogram.profile = profiles[p].name;
+        histogram.networks = count;
+        histogram.scoreSum = total.scoreSum;
+        histogram.grades[static_cast<size_t>(SecurityGrade::VERY_BAD)] = count - total.atLeast[0];
+        histogram.grades[static_cast<size_t>(SecurityGrade::BAD)] = total.atLeast[0] - total.atLeast[1];
+        histogram.grades[static_cast<size_t>(SecurityGrade::OKAY)] = total.atLeast[1] - total.atLeast[2];
+        histogram.grades[static_cast<size_t>(SecurityGrade::GOOD)] = total.atLeast[2] - total.atLeast[3];
+        histogram.grades[static_cast<size_t>(SecurityGrade::EXCELLENT)] = total.atLeast[3];
+    }
+    return histograms;
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,319 @@
+#include "IncrementalGrader.h"
+#include "ScoreCache.h"
+#include "Tracing.h"
+#include <algorithm>
+#include <utility>
+
+namespace WifiScanner {
+
+namespace {
+
+// Field access shared by the vector and table forms of update()
+const NetworkInfo& networkAt(const std::vector<NetworkInfo>& networks, size_t index) { return networks[index]; }
+NetworkTable::Row networkAt(const NetworkTable& table, size_t index) { return table[index]; }
+
+std::string_view bssidOf(const NetworkInfo& network) { return network.bssid; }
+std::string_view bssidOf(const NetworkTable::Row& network) { return network.bssid(); }
+
+uint32_t flagsOf(const NetworkInfo& network) { return packNetworkFlags(network); }
+uint32_t flagsOf(const NetworkTable::Row& network) { return network.flags(); }
+
+} // namespace
+
+IncrementalGrader::IncrementalGrader(const SecurityGrader& grader) : grader_(grader) {
+}
+
+IncrementalUpdateStats IncrementalGrader::update(const std::vector<NetworkInfo>& networks) {
+    return updateFrom(networks);
+}
+
+IncrementalUpdateStats IncrementalGrader::update(const NetworkTable& table) {
+    return updateFrom(table);
+}
+
+template <typename Networks>
+IncrementalUpdateStats IncrementalGrader::updateFrom(const Networks& networks) {
+    WIFI_TRACE_SCOPE(INCREMENTAL_UPDATE);
+    
+    IncrementalUpdateStats stats;
+    ++generation_;
+    
+    std::vector<uint32_t> dirtySlots;
+    std::vector<uint64_t> staleKeys;
+    
+    // Match every network to its entry and compare scoring fingerprints
+    for (uint32_t index = 0; index < networks.size(); ++index) {
+        const auto& network = networkAt(networks, index);
+        
+        // BSSID hashed in place with FNV-1a
+        uint64_t bssidHash = 0xCBF29CE484222325ull;
+        for (unsigned char c : bssidOf(network)) {
+            bssidHash ^= c;
+            bssidHash *= 0x100000001B3ull;
+        }
+        
+        uint64_t key = entryKey(bssidHash, 0);
+        uint32_t* found = findIndex(key);
+        for (size_t occurrence = 1; found && slots_[*found].lastSeen == generation_; ++occurrence) {
+            key = entryKey(bssidHash, occurrence);
+            found = findIndex(key);
+        }
+        
+        const uint64_t fingerprint = ScoreCache::fingerprint(network);
+        if (found) {
+            Entry& entry = slots_[*found];
+            entry.scanIndex = index;
+            entry.lastSeen = generation_;
+            if (entry.fingerprint != fingerprint) {
+                entry.fingerprint = fingerprint;
+                staleKeys.push_back(entry.rankingKey);
+                dirtySlots.push_back(*found);
+                ++stats.changed;
+            } else {
+                ++stats.unchanged;
+            }
+            continue;
+        }
+        
+        // New entries always go last, so the slot order is the first-seen order
+        const uint32_t slot = static_cast<uint32_t>(slots_.size());
+        slots_.emplace_back();
+        Entry& entry = slots_[slot];
+        entry.scanIndex = index;
+        entry.entryKey = key;
+        entry.fingerprint = fingerprint;
+        entry.lastSeen = generation_;
+        insertIndex(key, slot);
+        dirtySlots.push_back(slot);
+        ++stats.added;
+    }
+    
+    // Drop networks that were not seen in this scan
+    for (uint32_t slot = 0; slot < slots_.size(); ++slot) {
+        Entry& entry = slots_[slot];
+        if (entry.lastSeen == 0 || entry.lastSeen == generation_) {
+            continue;
+        }
+        staleKeys.push_back(entry.rankingKey);
+        eraseIndex(entry.entryKey);
+        entry = Entry();
+        ++stats.removed;
+    }
+    
+    WIFI_TRACE_COUNT(NETWORKS_REGRADED, dirtySlots.size());
+    WIFI_TRACE_COUNT(NETWORKS_REUSED, stats.unchanged);
+    
+    // Regrade only the dirty entries; the breakdown is kept for display
+    for (uint32_t slot : dirtySlots) {
+        Entry& entry = slots_[slot];
+        const auto& network = networkAt(networks, entry.scanIndex);
+        entry.breakdown = grader_.scoreBreakdown(network);
+        entry.rankingKey = SecurityGrader::makeRankingKey(entry.breakdown.score, flagsOf(network), slot);
+    }
+    
+    const size_t patchSize = staleKeys.size() + dirtySlots.size();
+    if (sortedKeys_.empty() || patchSize > REBUILD_FRACTION * liveCount_) {
+        sortedKeys_.clear();
+        sortedKeys_.reserve(liveCount_);
+        for (const Entry& entry : slots_) {
+            if (entry.lastSeen != 0) {
+                sortedKeys_.push_back(entry.rankingKey);
+            }
+        }
+        SecurityGrader::radixSortKeys(sortedKeys_);
+        stats.rebuilt = true;
+    } else {
+        patchSortedKeys(staleKeys, dirtySlots);
+    }
+    
+    if (slots_.size() > 2 * liveCount_ + 64) {
+        compactSlots();
+    }
+    return stats;
+}
+
+void IncrementalGrader::patchSortedKeys(std::vector<uint64_t>& staleKeys, const std::vector<uint32_t>& dirtySlots) {
+    // Patch the order in two linear passes: remove the stale keys, then merge in
+    // the regraded ones. Keys end in the slot, so they are unique.
+    std::sort(staleKeys.begin(), staleKeys.end());
+    auto stale = staleKeys.begin();
+    size_t keptCount = 0;
+    for (uint64_t key : sortedKeys_) {
+        while (stale != staleKeys.end() && *stale < key) {
+            ++stale;
+        }
+        if (stale == staleKeys.end() || *stale != key) {
+            sortedKeys_[keptCount++] = key;
+        }
+    }
+    sortedKeys_.resize(keptCount);
+    
+    for (uint32_t slot : dirtySlots) {
+        sortedKeys_.push_back(slots_[slot].rankingKey);
+    }
+    std::sort(sortedKeys_.begin() + keptCount, sortedKeys_.end());
+    std::inplace_merge(sortedKeys_.begin(), sortedKeys_.begin() + keptCount, sortedKeys_.end());
+}
+
+void IncrementalGrader::compactSlots() {
+    // Renumbering is monotonic, so the sorted keys stay sorted once their
+    // slot field is rewritten
+    auto withSlot = [](uint64_t key, uint32_t slot) { return (key & ~0xFFFFFFFFull) | slot; };
+    
+    std::vector<uint32_t> renumbered(slots_.size(), 0);
+    uint32_t live = 0;
+    for (uint32_t slot = 0; slot < slots_.size(); ++slot) {
+        if (slots_[slot].lastSeen == 0) {
+            continue;
+        }
+        Entry& entry = slots_[slot];
+        entry.rankingKey = withSlot(entry.rankingKey, live);
+        *findIndex(entry.entryKey) = live;
+        renumbered[slot] = live;
+        if (live != slot) {
+            slots_[live] = entry;
+        }
+        ++live;
+    }
+    slots_.resize(live);
+    
+    for (uint64_t& key : sortedKeys_) {
+        key = withSlot(key, renumbered[SecurityGrader::rankingKeyIndex(key)]);
+    }
+}
+
+std::vector<NetworkInfo> IncrementalGrader::sortedNetworks(const std::vector<NetworkInfo>& networks) const {
+    std::vector<NetworkInfo> sorted;
+    sorted.reserve(sortedKeys_.size());
+    for (uint64_t key : sortedKeys_) {
+        sorted.push_back(networks[slots_[SecurityGrader::rankingKeyIndex(key)].scanIndex]);
+    }
+    return sorted;
+}
+
+std::vector<NetworkInfo> IncrementalGrader::sortedNetworks(std::vector<NetworkInfo>&& networks) const {
+    // order[i] is the scan position of the i-th best network
+    std::vector<uint32_t> order = sortedRows();
+    
+    // Permute in place by following cycles, which avoids allocating and
+    // faulting in a second result vector; finished positions point to themselves
+    for (uint32_t start = 0; start < order.size(); ++start) {
+        if (order[start] == start) {
+            continue;
+        }
+        NetworkInfo first = std::move(networks[start]);
+        uint32_t position = start;
+        while (order[position] != start) {
+            const uint32_t source = order[position];
+            networks[position] = std::move(networks[source]);
+            order[position] = position;
+            position = source;
+        }
+        networks[position] = std::move(first);
+        order[position] = position;
+    }
+    return std::move(networks);
+}
+
+std::vector<uint32_t> IncrementalGrader::sortedRows() const {
+    std::vector<uint32_t> rows;
+    rows.reserve(sortedKeys_.size());
+    for (uint64_t key : sortedKeys_) {
+        rows.push_back(slots_[SecurityGrader::rankingKeyIndex(key)].scanIndex);
+    }
+    return rows;
+}
+
+std::vector<ScoreBreakdown> IncrementalGrader::sortedBreakdowns() const {
+    std::vector<ScoreBreakdown> breakdowns;
+    breakdowns.reserve(sortedKeys_.size());
+    for (uint64_t key : sortedKeys_) {
+        breakdowns.push_back(slots_[SecurityGrader::rankingKeyIndex(key)].breakdown);
+    }
+    return breakdowns;
+}
+
+void IncrementalGrader::clear() {
+    indexKeys_.clear();
+    indexSlots_.clear();
+    liveCount_ = 0;
+    slots_.clear();
+    sortedKeys_.clear();
+}
+
+uint64_t IncrementalGrader::entryKey(uint64_t bssidHash, size_t occurrence) {
+    // splitmix64 finalizer so that similar BSSIDs spread over the index;
+    // never 0, which marks an empty index cell
+    uint64_t key = bssidHash + occurrence * 0x9E3779B97F4A7C15ull;
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ull;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBull;
+    key ^= key >> 31;
+    return key | 1;
+}
+
+uint32_t* IncrementalGrader::findIndex(uint64_t key) {
+    if (indexKeys_.empty()) {
+        return nullptr;
+    }
+    const size_t mask = indexKeys_.size() - 1;
+    for (size_t cell = (key >> 20) & mask; indexKeys_[cell] != 0; cell = (cell + 1) & mask) {
+        if (indexKeys_[cell] == key) {
+            return &indexSlots_[cell];
+        }
+    }
+    return nullptr;
+}
+
+void IncrementalGrader::insertIndex(uint64_t key, uint32_t slot) {
+    // Keep the load factor at or below one half
+    if (2 * (liveCount_ + 1) > indexKeys_.size()) {
+        growIndex();
+    }
+    const size_t mask = indexKeys_.size() - 1;
+    size_t cell = (key >> 20) & mask;
+    while (indexKeys_[cell] != 0) {
+        cell = (cell + 1) & mask;
+    }
+    indexKeys_[cell] = key;
+    indexSlots_[cell] = slot;
+    ++liveCount_;
+}
+
+void IncrementalGrader::eraseIndex(uint64_t key) {
+    const size_t mask = indexKeys_.size() - 1;
+    size_t cell = (key >> 20) & mask;
+    while (indexKeys_[cell] != key) {
+        cell = (cell + 1) & mask;
+    }
+    
+    // Backward-shift deletion: pull later entries of the probe run into the
+    // hole so that lookups never need tombstones
+    for (size_t next = (cell + 1) & mask; indexKeys_[next] != 0; next = (next + 1) & mask) {
+        const size_t home = (indexKeys_[next] >> 20) & mask;
+        if (((next - home) & mask) >= ((next - cell) & mask)) {
+            indexKeys_[cell] = indexKeys_[next];
+            indexSlots_[cell] = indexSlots_[next];
+            cell = next;
+        }
+    }
+    indexKeys_[cell] = 0;
+    --liveCount_;
+}
+
+void IncrementalGrader::growIndex() {
+    std::vector<uint64_t> oldKeys(std::max<size_t>(64, indexKeys_.size() * 2), 0);
+    std::vector<uint32_t> oldSlots(oldKeys.size(), 0);
+    oldKeys.swap(indexKeys_);
+    oldSlots.swap(indexSlots_);
+    
+    liveCount_ = 0;
+    for (size_t cell = 0; cell < oldKeys.size(); ++cell) {
+        if (oldKeys[cell] != 0) {
+            insertIndex(oldKeys[cell], oldSlots[cell]);
+        }
+    }
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,89 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define WIFI_SCANNER_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace WifiScanner {
+
+MappedFile::MappedFile(const std::string& path, const std::string& kind) {
+#ifdef WIFI_SCANNER_HAVE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error(path + ": cannot open " + kind);
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error(path + ": cannot read " + kind + " size");
+    }
+    // mmap rejects empty files; they are read as an empty buffer instead
+    if (info.st_size > 0) {
+        const size_t length = static_cast<size_t>(info.st_size);
+        void* region = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (region == MAP_FAILED) {
+            throw std::runtime_error(path + ": mmap failed");
+        }
+        region_ = static_cast<const char*>(region);
+        length_ = length;
+        mapped_ = true;
+        return;
+    }
+    ::close(fd);
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error(path + ": cannot open " + kind);
+    }
+    buffer_.resize(static_cast<size_t>(in.tellg()));
+    in.seekg(0);
+    if (!in.read(&buffer_[0], static_cast<std::streamsize>(buffer_.size()))) {
+        throw std::runtime_error(path + ": read failed");
+    }
+#endif
+}
+
+MappedFile::MappedFile(std::string&& contents) : buffer_(std::move(contents)) {
+}
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : region_(std::exchange(other.region_, nullptr)), length_(std::exchange(other.length_, 0)),
+      mapped_(std::exchange(other.mapped_, false)), buffer_(std::move(other.buffer_)) {
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        region_ = std::exchange(other.region_, nullptr);
+        length_ = std::exchange(other.length_, 0);
+        mapped_ = std::exchange(other.mapped_, false);
+        buffer_ = std::move(other.buffer_);
+    }
+    return *this;
+}
+
+void MappedFile::release() {
+#ifdef WIFI_SCANNER_HAVE_MMAP
+    if (mapped_) {
+        munmap(const_cast<char*>(region_), length_);
+    }
+#endif
+    region_ = nullptr;
+    length_ = 0;
+    mapped_ = false;
+    buffer_.clear();
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,114 @@
+#include "NetworkBatch.h"
+#include "CompactNetwork.h"
+#include "SecurityGrader.h"
+#include "VendorRegistry.h"
+
+namespace WifiScanner {
+
+uint32_t packNetworkFlags(const NetworkInfo& network) {
+    uint32_t flags = 0;
+    if (network.isHidden) flags |= FLAG_HIDDEN;
+    if (network.isEnterprise) flags |= FLAG_ENTERPRISE;
+    if (network.supportsWPS) flags |= FLAG_WPS;
+    if (network.supportsPMF) flags |= FLAG_PMF;
+    if (network.supportsOWE) flags |= FLAG_OWE;
+    if (network.isGuestNetwork) flags |= FLAG_GUEST;
+    if (network.isRogueAP) flags |= FLAG_ROGUE_AP;
+    if (network.isEvilTwin) flags |= FLAG_EVIL_TWIN;
+    if (network.isTypoSquatting) flags |= FLAG_TYPO_SQUATTING;
+    if (network.respondsToProbes) flags |= FLAG_RESPONDS_PROBES;
+    if (network.hasAnomalousBehavior) flags |= FLAG_ANOMALOUS;
+    return flags;
+}
+
+void unpackNetworkFlags(uint32_t flags, NetworkInfo& network) {
+    network.isHidden = flags & FLAG_HIDDEN;
+    network.isEnterprise = flags & FLAG_ENTERPRISE;
+    network.supportsWPS = flags & FLAG_WPS;
+    network.supportsPMF = flags & FLAG_PMF;
+    network.supportsOWE = flags & FLAG_OWE;
+    network.isGuestNetwork = flags & FLAG_GUEST;
+    network.isRogueAP = flags & FLAG_ROGUE_AP;
+    network.isEvilTwin = flags & FLAG_EVIL_TWIN;
+    network.isTypoSquatting = flags & FLAG_TYPO_SQUATTING;
+    network.respondsToProbes = flags & FLAG_RESPONDS_PROBES;
+    network.hasAnomalousBehavior = flags & FLAG_ANOMALOUS;
+}
+
+int32_t resolveVendorScore(const NetworkInfo& network) {
+    return network.vendorId != VendorRegistry::NO_VENDOR
+               ? VendorRegistry::instance().score(network.vendorId)
+               : SecurityGrader::vendorScore(network.vendor);
+}
+
+NetworkBatch::NetworkBatch(const std::vector<NetworkInfo>& networks) {
+    reserve(networks.size());
+    for (const auto& network : networks) {
+        append(network);
+    }
+}
+
+void NetworkBatch::append(const NetworkInfo& network) {
+    securityType_.push_back(static_cast<int32_t>(network.securityType));
+    signalStrength_.push_back(network.signalStrength);
+    channel_.push_back(network.channel);
+    frequency_.push_back(network.frequency);
+    channelWidth_.push_back(network.channelWidth);
+    maxDataRate_.push_back(network.maxDataRate);
+    beaconInterval_.push_back(network.beaconInterval);
+    vendorScore_.push_back(resolveVendorScore(network));
+    flags_.push_back(packNetworkFlags(network));
+}
+
+void NetworkBatch::append(const CompactNetwork& network) {
+    securityType_.push_back(static_cast<int32_t>(network.securityType));
+    signalStrength_.push_back(network.signalStrength);
+    channel_.push_back(network.channel);
+    frequency_.push_back(network.frequency);
+    channelWidth_.push_back(network.channelWidth);
+    maxDataRate_.push_back(network.maxDataRate);
+    beaconInterval_.push_back(network.beaconInterval);
+    vendorScore_.push_back(VendorRegistry::instance().score(network.vendorId));
+    flags_.push_back(network.flags);
+}
+
+void NetworkBatch::reserve(size_t count) {
+    securityType_.reserve(count);
+    signalStrength_.reserve(count);
+    channel_.reserve(count);
+    frequency_.reserve(count);
+    channelWidth_.reserve(count);
+    maxDataRate_.reserve(count);
+    beaconInterval_.reserve(count);
+    vendorScore_.reserve(count);
+    flags_.reserve(count);
+}
+
+void NetworkBatch::clear() {
+    securityType_.clear();
+    signalStrength_.clear();
+    channel_.clear();
+    frequency_.clear();
+    channelWidth_.clear();
+    maxDataRate_.clear();
+    beaconInterval_.clear();
+    vendorScore_.clear();
+    flags_.clear();
+}
+
+NetworkBatchView NetworkBatch::view() const {
+    NetworkBatchView view;
+    view.size = size();
+    view.securityType = securityType_.data();
+    view.signalStrength = signalStrength_.data();
+    view.channel = channel_.data();
+    view.frequency = frequency_.data();
+    view.channelWidth = channelWidth_.data();
+    view.maxDataRate = maxDataRate_.data();
+    view.beaconInterval = beaconInterval_.data();
+    view.vendorScore = vendorScore_.data();
+    view.flags = flags_.data();
+    return view;
+}
+
+} // namespace WifiScanner
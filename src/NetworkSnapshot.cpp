@@ -0,0 +1,274 @@
+#include "NetworkSnapshot.h"
+#include "VendorRegistry.h"
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace WifiScanner {
+
+namespace {
+
+constexpr uint64_t align8(uint64_t value) {
+    return (value + 7) & ~uint64_t(7);
+}
+
+// One column as written: its directory entry and where its bytes come from
+struct Section {
+    SnapshotColumn column;
+    SnapshotType type;
+    const void* data;
+    uint64_t size;
+};
+
+size_t typeSize(SnapshotType type) {
+    switch (type) {
+        case SnapshotType::INT32: return sizeof(int32_t);
+        case SnapshotType::UINT32: return sizeof(uint32_t);
+        case SnapshotType::STRING: return sizeof(SnapshotString);
+    }
+    return 0;
+}
+
+} // namespace
+
+void saveSnapshot(const NetworkTable& table, const std::string& path) {
+    const size_t rows = table.size();
+
+    std::string heap;
+    auto strings = [&heap, &path](ColumnSpan<std::pmr::string> column) {
+        std::vector<SnapshotString> refs(column.size());
+        for (size_t i = 0; i < column.size(); ++i) {
+            if (heap.size() + column[i].size() > std::numeric_limits<uint32_t>::max()) {
+                throw std::runtime_error(path + ": string heap would exceed 4 GiB");
+            }
+            refs[i] = {static_cast<uint32_t>(heap.size()), static_cast<uint32_t>(column[i].size())};
+            heap.append(column[i]);
+        }
+        return refs;
+    };
+    const std::vector<SnapshotString> ssid = strings(table.ssids());
+    const std::vector<SnapshotString> bssid = strings(table.bssids());
+    const std::vector<SnapshotString> capabilities = strings(table.capabilities());
+    const std::vector<SnapshotString> vendor = strings(table.vendors());
+    const std::vector<SnapshotString> radios = strings(table.radios());
+
+    auto section = [rows](SnapshotColumn column, SnapshotType type, const void* data) {
+        return Section{column, type, data, rows * typeSize(type)};
+    };
+    const Section sections[] = {
+        section(SnapshotColumn::SSID, SnapshotType::STRING, ssid.data()),
+        section(SnapshotColumn::BSSID, SnapshotType::STRING, bssid.data()),
+        section(SnapshotColumn::SECURITY_TYPE, SnapshotType::INT32, table.securityTypes().data()),
+        section(SnapshotColumn::SIGNAL_STRENGTH, SnapshotType::INT32, table.signalStrengths().data()),
+        section(SnapshotColumn::CHANNEL, SnapshotType::INT32, table.channels().data()),
+        section(SnapshotColumn::FREQUENCY, SnapshotType::INT32, table.frequencies().data()),
+        section(SnapshotColumn::CAPABILITIES, SnapshotType::STRING, capabilities.data()),
+        section(SnapshotColumn::CHANNEL_WIDTH, SnapshotType::INT32, table.channelWidths().data()),
+        section(SnapshotColumn::MAX_DATA_RATE, SnapshotType::INT32, table.maxDataRates().data()),
+        section(SnapshotColumn::VENDOR, SnapshotType::STRING, vendor.data()),
+        section(SnapshotColumn::BEACON_INTERVAL, SnapshotType::INT32, table.beaconIntervals().data()),
+        section(SnapshotColumn::FLAGS, SnapshotType::UINT32, table.flags().data()),
+        section(SnapshotColumn::VENDOR_SCORE, SnapshotType::INT32, table.vendorScores().data()),
+        section(SnapshotColumn::RADIOS, SnapshotType::STRING, radios.data())
+    };
+    const size_t columnCount = sizeof(sections) / sizeof(sections[0]);
+
+    // Lay out the directory, then each column, then the heap
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SnapshotTable::MAGIC, sizeof(header.magic));
+    header.version = SnapshotTable::VERSION;
+    header.byteOrder = SnapshotTable::BYTE_ORDER_MARK;
+    header.rowCount = rows;
+    header.columnCount = static_cast<uint32_t>(columnCount);
+    header.directoryOffset = sizeof(SnapshotHeader);
+
+    std::vector<SnapshotColumnEntry> directory;
+    uint64_t offset = align8(header.directoryOffset + columnCount * sizeof(SnapshotColumnEntry));
+    for (const Section& column : sections) {
+        directory.push_back({column.column, column.type, offset, column.size});
+        offset = align8(offset + column.size);
+    }
+    header.heapOffset = offset;
+    header.heapSize = heap.size();
+    header.fileSize = header.heapOffset + header.heapSize;
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error(path + ": cannot open for writing");
+    }
+    uint64_t written = 0;
+    auto write = [&out, &written](const void* data, uint64_t size) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        written += size;
+    };
+    auto padTo = [&write, &written](uint64_t target) {
+        static const char zeros[8] = {};
+        write(zeros, target - written);
+    };
+
+    write(&header, sizeof(header));
+    write(directory.data(), directory.size() * sizeof(SnapshotColumnEntry));
+    for (size_t i = 0; i < columnCount; ++i) {
+        padTo(directory[i].offset);
+        write(sections[i].data, sections[i].size);
+    }
+    padTo(header.heapOffset);
+    write(heap.data(), heap.size());
+
+    out.flush();
+    if (!out) {
+        throw std::runtime_error(path + ": write failed");
+    }
+}
+
+SnapshotTable::SnapshotTable(const std::string& path) : file_(path, "snapshot") {
+    bindColumns(path);
+}
+
+void SnapshotTable::bindColumns(const std::string& path) {
+    auto fail = [&path](const std::string& message) {
+        throw std::runtime_error(path + ": " + message);
+    };
+
+    const char* data = file_.data();
+    const size_t length = file_.size();
+    if (length < sizeof(SnapshotHeader)) {
+        fail("too small to be a snapshot");
+    }
+    SnapshotHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        fail("not a snapshot file");
+    }
+    if (header.version != VERSION) {
+        fail("unsupported snapshot version " + std::to_string(header.version));
+    }
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        fail("snapshot was written with a different byte order");
+    }
+    if (header.fileSize != length) {
+        fail("file is " + std::to_string(length) + " bytes, header says " + std::to_string(header.fileSize));
+    }
+    if (header.directoryOffset % 8 != 0 || header.directoryOffset > length ||
+        header.columnCount > (length - header.directoryOffset) / sizeof(SnapshotColumnEntry)) {
+        fail("column directory is out of bounds");
+    }
+    if (header.heapOffset > length || header.heapSize > length - header.heapOffset) {
+        fail("string heap is out of bounds");
+    }
+    if (header.rowCount > length) {
+        fail("row count is out of bounds");
+    }
+    rows_ = static_cast<size_t>(header.rowCount);
+    heap_ = data + header.heapOffset;
+
+    // Bind every known column; unknown ones are skipped so later versions can add columns
+    const char* seen[16] = {};
+    for (uint32_t i = 0; i < header.columnCount; ++i) {
+        SnapshotColumnEntry entry;
+        std::memcpy(&entry, data + header.directoryOffset + i * sizeof(entry), sizeof(entry));
+        const uint32_t id = static_cast<uint32_t>(entry.column);
+        if (id == 0 || id > static_cast<uint32_t>(SnapshotColumn::RADIOS)) {
+            continue;
+        }
+        if (seen[id]) {
+            fail("column " + std::to_string(id) + " appears twice");
+        }
+        if (entry.offset % 8 != 0 || entry.offset > length || entry.size > length - entry.offset ||
+            entry.size != rows_ * typeSize(entry.type)) {
+            fail("column " + std::to_string(id) + " is out of bounds");
+        }
+        seen[id] = data + entry.offset;
+
+        const SnapshotColumn column = entry.column;
+        const SnapshotType expected = (column == SnapshotColumn::SSID || column == SnapshotColumn::BSSID ||
+                                       column == SnapshotColumn::CAPABILITIES || column == SnapshotColumn::VENDOR ||
+                                       column == SnapshotColumn::RADIOS)
+                                          ? SnapshotType::STRING
+                                      : column == SnapshotColumn::FLAGS ? SnapshotType::UINT32
+                                                                        : SnapshotType::INT32;
+        if (entry.type != expected) {
+            fail("column " + std::to_string(id) + " has the wrong type");
+        }
+    }
+    for (uint32_t id = 1; id <= static_cast<uint32_t>(SnapshotColumn::VENDOR_SCORE); ++id) {
+        if (!seen[id]) {
+            fail("snapshot is missing column " + std::to_string(id));
+        }
+    }
+
+    auto column = [&seen](SnapshotColumn id) { return seen[static_cast<uint32_t>(id)]; };
+    ssid_ = reinterpret_cast<const SnapshotString*>(column(SnapshotColumn::SSID));
+    bssid_ = reinterpret_cast<const SnapshotString*>(column(SnapshotColumn::BSSID));
+    securityType_ = reinterpret_cast<const int32_t*>(column(SnapshotColumn::SECURITY_TYPE));
+    signalStrength_ = reinterpret_cast<const int32_t*>(column(SnapshotColumn::SIGNAL_STRENGTH));
+    channel_ = reinterpret_cast<const int32_t*>(column(SnapshotColumn::CHANNEL));
+    frequency_ = reinterpret_cast<const int32_t*>(column(SnapshotColumn::FREQUENCY));
+    capabilities_ = reinterpret_cast<const SnapshotString*>(column(SnapshotColumn::CAPABILITIES));
+    channelWidth_ = reinterpret_cast<const int32_t*>(column(SnapshotColumn::CHANNEL_WIDTH));
+    maxDataRate_ = reinterpret_cast<const int32_t*>(column(SnapshotColumn::MAX_DATA_RATE));
+    vendor_ = reinterpret_cast<const SnapshotString*>(column(SnapshotColumn::VENDOR));
+    beaconInterval_ = reinterpret_cast<const int32_t*>(column(SnapshotColumn::BEACON_INTERVAL));
+    flags_ = reinterpret_cast<const uint32_t*>(column(SnapshotColumn::FLAGS));
+    vendorScore_ = reinterpret_cast<const int32_t*>(column(SnapshotColumn::VENDOR_SCORE));
+    radios_ = reinterpret_cast<const SnapshotString*>(column(SnapshotColumn::RADIOS));
+
+    // The only per-row check: strings must lie inside the heap
+    for (const SnapshotString* strings : {ssid_, bssid_, capabilities_, vendor_, radios_}) {
+        if (!strings) {
+            continue;
+        }
+        for (size_t row = 0; row < rows_; ++row) {
+            if (static_cast<uint64_t>(strings[row].offset) + strings[row].length > header.heapSize) {
+                fail("string in row " + std::to_string(row) + " is out of bounds");
+            }
+        }
+    }
+}
+
+NetworkBatchView SnapshotTable::view() const {
+    NetworkBatchView view;
+    view.size = rows_;
+    view.securityType = securityType_;
+    view.signalStrength = signalStrength_;
+    view.channel = channel_;
+    view.frequency = frequency_;
+    view.channelWidth = channelWidth_;
+    view.maxDataRate = maxDataRate_;
+    view.beaconInterval = beaconInterval_;
+    view.vendorScore = vendorScore_;
+    view.flags = flags_;
+    return view;
+}
+
+NetworkInfo SnapshotTable::networkAt(size_t row) const {
+    NetworkInfo network;
+    network.ssid = ssid(row);
+    network.bssid = bssid(row);
+    network.securityType = static_cast<SecurityType>(securityType_[row]);
+    network.signalStrength = signalStrength_[row];
+    network.channel = channel_[row];
+    network.frequency = frequency_[row];
+    network.capabilities = capabilities(row);
+    network.channelWidth = channelWidth_[row];
+    network.maxDataRate = maxDataRate_[row];
+    network.vendor = vendor(row);
+    network.vendorId = VendorRegistry::instance().intern(network.vendor);
+    network.radios = radios(row);
+    network.beaconInterval = beaconInterval_[row];
+    unpackNetworkFlags(flags_[row], network);
+    return network;
+}
+
+NetworkTable SnapshotTable::toNetworkTable(std::pmr::memory_resource* resource) const {
+    NetworkTable table(resource);
+    table.reserve(rows_);
+    for (size_t row = 0; row < rows_; ++row) {
+        table.append(networkAt(row));
+    }
+    return table;
+}
+
+} // namespace WifiScanner
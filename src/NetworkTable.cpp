@@ -0,0 +1,193 @@
+#include "NetworkTable.h"
+#include "ScoringTables.h"
+#include <algorithm>
+
+namespace WifiScanner {
+
+NetworkInfo NetworkTable::Row::toNetworkInfo() const {
+    NetworkInfo network;
+    network.ssid = ssid();
+    network.bssid = bssid();
+    network.securityType = securityType();
+    network.signalStrength = signalStrength();
+    network.channel = channel();
+    network.frequency = frequency();
+    network.capabilities = capabilities();
+    network.channelWidth = channelWidth();
+    network.maxDataRate = maxDataRate();
+    network.vendor = vendor();
+    network.vendorId = vendorId();
+    network.radios = radios();
+    network.beaconInterval = beaconInterval();
+    unpackNetworkFlags(flags(), network);
+    return network;
+}
+
+NetworkTable::NetworkTable(std::pmr::memory_resource* resource)
+    : ssid_(resource), bssid_(resource), securityType_(resource), signalStrength_(resource),
+      channel_(resource), frequency_(resource), capabilities_(resource), channelWidth_(resource),
+      maxDataRate_(resource), vendor_(resource), vendorId_(resource), radios_(resource),
+      beaconInterval_(resource), flags_(resource), vendorScore_(resource) {
+}
+
+NetworkTable::NetworkTable(const std::vector<NetworkInfo>& networks, std::pmr::memory_resource* resource)
+    : NetworkTable(resource) {
+    append(networks);
+}
+
+void NetworkTable::append(const NetworkInfo& network) {
+    ssid_.emplace_back(network.ssid);
+    bssid_.emplace_back(network.bssid);
+    securityType_.push_back(static_cast<int32_t>(network.securityType));
+    signalStrength_.push_back(network.signalStrength);
+    channel_.push_back(network.channel);
+    frequency_.push_back(network.frequency);
+    capabilities_.emplace_back(network.capabilities);
+    channelWidth_.push_back(network.channelWidth);
+    maxDataRate_.push_back(network.maxDataRate);
+    vendor_.emplace_back(network.vendor);
+    vendorId_.push_back(network.vendorId);
+    radios_.emplace_back(network.radios);
+    beaconInterval_.push_back(network.beaconInterval);
+    flags_.push_back(packNetworkFlags(network));
+    vendorScore_.push_back(resolveVendorScore(network));
+}
+
+void NetworkTable::append(const std::vector<NetworkInfo>& networks) {
+    reserve(size() + networks.size());
+    for (const auto& network : networks) {
+        append(network);
+    }
+}
+
+void NetworkTable::reserve(size_t count) {
+    ssid_.reserve(count);
+    bssid_.reserve(count);
+    securityType_.reserve(count);
+    signalStrength_.reserve(count);
+    channel_.reserve(count);
+    frequency_.reserve(count);
+    capabilities_.reserve(count);
+    channelWidth_.reserve(count);
+    maxDataRate_.reserve(count);
+    vendor_.reserve(count);
+    vendorId_.reserve(count);
+    radios_.reserve(count);
+    beaconInterval_.reserve(count);
+    flags_.reserve(count);
+    vendorScore_.reserve(count);
+}
+
+void NetworkTable::clear() {
+    ssid_.clear();
+    bssid_.clear();
+    securityType_.clear();
+    signalStrength_.clear();
+    channel_.clear();
+    frequency_.clear();
+    capabilities_.clear();
+    channelWidth_.clear();
+    maxDataRate_.clear();
+    vendor_.clear();
+    vendorId_.clear();
+    radios_.clear();
+    beaconInterval_.clear();
+    flags_.clear();
+    vendorScore_.clear();
+}
+
+std::vector<NetworkInfo> NetworkTable::toNetworkInfos() const {
+    std::vector<NetworkInfo> networks;
+    networks.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        networks.push_back(row(i).toNetworkInfo());
+    }
+    return networks;
+}
+
+NetworkTable NetworkTable::select(const std::vector<uint32_t>& rows) const {
+    // Gather column by column so each pass streams through one source array
+    auto gather = [&rows](const auto& source, auto& target) {
+        target.reserve(rows.size());
+        for (uint32_t index : rows) {
+            target.push_back(source[index]);
+        }
+    };
+
+    NetworkTable result(resource());
+    gather(ssid_, result.ssid_);
+    gather(bssid_, result.bssid_);
+    gather(securityType_, result.securityType_);
+    gather(signalStrength_, result.signalStrength_);
+    gather(channel_, result.channel_);
+    gather(frequency_, result.frequency_);
+    gather(capabilities_, result.capabilities_);
+    gather(channelWidth_, result.channelWidth_);
+    gather(maxDataRate_, result.maxDataRate_);
+    gather(vendor_, result.vendor_);
+    gather(vendorId_, result.vendorId_);
+    gather(radios_, result.radios_);
+    gather(beaconInterval_, result.beaconInterval_);
+    gather(flags_, result.flags_);
+    gather(vendorScore_, result.vendorScore_);
+    return result;
+}
+
+NetworkBatchView NetworkTable::view() const {
+    NetworkBatchView view;
+    view.size = size();
+    view.securityType = securityType_.data();
+    view.signalStrength = signalStrength_.data();
+    view.channel = channel_.data();
+    view.frequency = frequency_.data();
+    view.channelWidth = channelWidth_.data();
+    view.maxDataRate = maxDataRate_.data();
+    view.beaconInterval = beaconInterval_.data();
+    view.vendorScore = vendorScore_.data();
+    view.flags = flags_.data();
+    return view;
+}
+
+WifiBand NetworkTable::bandOf(int frequency) {
+    return static_cast<WifiBand>((frequency >= 2400) + (frequency >= 5000) + (frequency >= 5925));
+}
+
+std::vector<uint32_t> NetworkTable::rowsInBand(WifiBand band) const {
+    std::vector<uint32_t> rows;
+    for (size_t i = 0; i < frequency_.size(); ++i) {
+        if (bandOf(frequency_[i]) == band) {
+            rows.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return rows;
+}
+
+std::array<size_t, 8> NetworkTable::countBySecurityType() const {
+    std::array<size_t, 8> counts{};
+    for (int32_t type : securityType_) {
+        // Out-of-range values count as UNKNOWN, as securityTypeToString() shows them
+        const size_t slot = (type >= 0 && type < 8) ? static_cast<size_t>(type)
+                                                    : static_cast<size_t>(SecurityType::UNKNOWN);
+        ++counts[slot];
+    }
+    return counts;
+}
+
+SignalStats NetworkTable::signalStats() const {
+    SignalStats stats;
+    if (signalStrength_.empty()) {
+        return stats;
+    }
+    const auto range = std::minmax_element(signalStrength_.begin(), signalStrength_.end());
+    int64_t sum = 0;
+    for (int32_t signal : signalStrength_) {
+        sum += signal;
+    }
+    stats.count = signalStrength_.size();
+    stats.min = *range.first;
+    stats.max = *range.second;
+    stats.mean = static_cast<double>(sum) / stats.count;
+    return stats;
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,357 @@
+#include "OuiRegistry.h"
+#include "platforms/ScanDecoding.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace WifiScanner {
+
+namespace {
+
+struct BuiltinVendor {
+    const char* name;
+    const char* ouis;  // Space-separated, six hex digits each
+};
+
+// Access point and client vendors common in scans. Names are the short forms
+// SecurityGrader::vendorScore matches; a full registry file gives IEEE names.
+const BuiltinVendor BUILTIN_VENDORS[] = {
+    {"Cisco", "00000C 004096 001CC0"},
+    {"Cisco Meraki", "00180A 0C8DDB 881544 AC17C8 E0553D"},
+    {"Aruba", "000B86 001A1E 24DEC6 6CF37F 94B40F D8C7C8"},
+    {"Ruckus", "002482 0025C4 58B633 74911A C4108A EC58EA"},
+    {"Ubiquiti", "00156D 002722 0418D6 18E829 24A43C 44D9E7 687251 788A20 802AA8 B4FBE4 DC9FDB E063DA F09FC2 FCECDA"},
+    {"MikroTik", "000C42 4C5E0C 64D154 6C3B6B B869F4 CC2DE0 D4CA6D E48D8C"},
+    {"Fortinet", "00090F 704CA5 906CAC"},
+    {"Juniper Mist", "5C5B35"},
+    {"TP-Link", "14CC20 50C7BF 60E327 98DAC4 A0F3C1 C04A00 E8DE27 EC086B F4F26D"},
+    {"Netgear", "00095B 000FB5 00146C 001B2F 001D7E 001E2A 001F33 00223F 0024B2 204E7F 28C68E A040A0 C03F0E"},
+    {"D-Link", "00055D 000D88 001195 001346 0015E9 00179A 00195B 001B11 001CF0 001E58 002191 0022B0 002401 "
+               "1C7EE5 28107B 84C9B2 C8BE19"},
+    {"Linksys", "00045A 000625 000C41 001217 001310 0014BF 0016B6 001839 0018F8 001A70 001C10 001EE5 002129 "
+                "00226B 002369 00259C C0C1C0"},
+    {"Asus", "000C6E 00112F 0013D4 0015F2 001731 0018F3 001A92 001D60 001E40 001E8C 002215 002354 00248C "
+             "002618 04D4C4 08606E 10BF48 14DAE9 1C872C 2C56DC 3085A9 50465D 5404A6 6045CB 74D02B AC220B "
+             "BCEE7B D850E6 F07959 F46D04"},
+    {"Apple", "000393 000502 000A27 000A95 000D93 0010FA 001124 001451 0016CB 0017F2 0019E3 001B63 001CB3 "
+              "001D4F 001E52 001EC2 001F5B 001FF3 0021E9 002241 002312 002332 00236C 0023DF 002436 002500 "
+              "00254B 0025BC 002608 00264A 0026B0 0026BB"},
+    {"Google", "001A11 3C5AB4 546009 F4F5D8 F4F5E8"},
+    {"Huawei", "00E0FC 001882 001E10 00259E 286ED4 4846FB"},
+    {"Dell", "001F3A"},
+    {"HP", "001F3B"},
+};
+
+constexpr uint32_t slotFor(uint32_t oui, uint32_t mask) {
+    const uint32_t hash = oui * 2654435761u;
+    return (hash ^ (hash >> 15)) & mask;
+}
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// One registry line in any of the accepted formats:
+//   IEEE oui.txt   "00-00-0C   (hex)\t\tCisco Systems, Inc"
+//   IEEE oui.csv   "MA-L,00000C,\"Cisco Systems, Inc\",..."
+//   Wireshark      "00:00:0C\tCisco\tCisco Systems, Inc"  (the long name wins)
+bool parseRegistryLine(std::string_view line, uint32_t& oui, std::string_view& name) {
+    line = trim(line);
+    if (line.empty() || line.front() == '#') {
+        return false;
+    }
+
+    if (line.substr(0, 5) == "MA-L,") {
+        line.remove_prefix(5);
+        const size_t comma = line.find(',');
+        if (comma == std::string_view::npos || !OuiRegistry::parseOui(line.substr(0, comma), oui)) {
+            return false;
+        }
+        line.remove_prefix(comma + 1);
+        if (!line.empty() && line.front() == '"') {
+            line.remove_prefix(1);
+            name = line.substr(0, line.find('"'));
+        } else {
+            name = line.substr(0, line.find(','));
+        }
+        name = trim(name);
+        return !name.empty();
+    }
+
+    // Only whole-OUI assignments; "/28" and "/36" blocks are narrower
+    const size_t end = line.find_first_of(" \t");
+    const std::string_view prefix = line.substr(0, end);
+    if (prefix.size() != 8 || !OuiRegistry::parseOui(prefix, oui) || end == std::string_view::npos) {
+        return false;
+    }
+    std::string_view rest = trim(line.substr(end));
+    if (rest.empty()) {
+        return false;
+    }
+
+    if (rest.substr(0, 5) == "(hex)") {
+        name = trim(rest.substr(5));
+        return !name.empty();
+    }
+    if (rest.front() == '(') {
+        return false;  // "(base 16)" repeats the "(hex)" line
+    }
+    const size_t tab = rest.find('\t');
+    name = tab == std::string_view::npos ? rest : trim(rest.substr(tab + 1));
+    name = trim(name.substr(0, name.find('#')));
+    if (name.empty()) {
+        name = trim(rest.substr(0, tab));
+    }
+    return !name.empty();
+}
+
+struct Entry {
+    uint32_t oui;
+    std::string_view name;
+};
+
+// The database image: header, hash table, name table and heap
+std::string buildImage(const std::vector<Entry>& entries) {
+    std::unordered_map<std::string_view, uint32_t> nameIndex;
+    std::vector<OuiName> names;
+    std::string heap;
+
+    uint32_t slotCount = 64;
+    while (slotCount < 2 * entries.size()) {
+        slotCount *= 2;
+    }
+    std::vector<OuiSlot> slots(slotCount, OuiSlot{OuiRegistry::EMPTY_SLOT, 0});
+
+    uint32_t entryCount = 0;
+    for (const Entry& entry : entries) {
+        uint32_t slot = slotFor(entry.oui, slotCount - 1);
+        while (slots[slot].oui != OuiRegistry::EMPTY_SLOT && slots[slot].oui != entry.oui) {
+            slot = (slot + 1) & (slotCount - 1);
+        }
+        if (slots[slot].oui == entry.oui) {
+            continue;  // The first assignment listed wins
+        }
+
+        auto known = nameIndex.find(entry.name);
+        if (known == nameIndex.end()) {
+            names.push_back(OuiName{static_cast<uint32_t>(heap.size()), static_cast<uint32_t>(entry.name.size())});
+            heap.append(entry.name);
+            known = nameIndex.emplace(entry.name, static_cast<uint32_t>(names.size() - 1)).first;
+        }
+        slots[slot] = OuiSlot{entry.oui, known->second};
+        ++entryCount;
+    }
+
+    OuiHeader header{};
+    std::memcpy(header.magic, OuiRegistry::MAGIC, sizeof(header.magic));
+    header.version = OuiRegistry::VERSION;
+    header.byteOrder = OuiRegistry::BYTE_ORDER_MARK;
+    header.entryCount = entryCount;
+    header.slotCount = slotCount;
+    header.nameCount = static_cast<uint32_t>(names.size());
+    header.heapSize = heap.size();
+    header.fileSize = sizeof(header) + slots.size() * sizeof(OuiSlot) + names.size() * sizeof(OuiName) + heap.size();
+
+    std::string image;
+    image.reserve(header.fileSize);
+    image.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    image.append(reinterpret_cast<const char*>(slots.data()), slots.size() * sizeof(OuiSlot));
+    image.append(reinterpret_cast<const char*>(names.data()), names.size() * sizeof(OuiName));
+    image.append(heap);
+    return image;
+}
+
+} // namespace
+
+const OuiRegistry& OuiRegistry::instance() {
+    static const std::unique_ptr<OuiRegistry> registry = [] {
+        const char* path = std::getenv("WIFI_SCANNER_OUI_DB");
+        return path && *path ? std::make_unique<OuiRegistry>(path) : std::make_unique<OuiRegistry>();
+    }();
+    return *registry;
+}
+
+OuiRegistry::OuiRegistry() {
+    std::vector<Entry> entries;
+    for (const BuiltinVendor& vendor : BUILTIN_VENDORS) {
+        std::string_view ouis(vendor.ouis);
+        while (!ouis.empty()) {
+            const size_t space = ouis.find(' ');
+            uint32_t oui = 0;
+            if (parseOui(ouis.substr(0, space), oui)) {
+                entries.push_back(Entry{oui, vendor.name});
+            }
+            ouis.remove_prefix(space == std::string_view::npos ? ouis.size() : space + 1);
+        }
+    }
+    adopt(buildImage(entries));
+}
+
+OuiRegistry::OuiRegistry(const std::string& path) {
+    char magic[sizeof(MAGIC)] = {};
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error(path + ": cannot open OUI registry");
+        }
+        in.read(magic, sizeof(magic));
+    }
+
+    if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0) {
+        image_ = MappedFile(path, "OUI database");
+        bind(path);
+        return;
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    std::ostringstream contents;
+    contents << in.rdbuf();
+    const std::string text = contents.str();
+
+    std::vector<Entry> entries;
+    size_t position = 0;
+    while (position < text.size()) {
+        size_t end = text.find('\n', position);
+        if (end == std::string::npos) {
+            end = text.size();
+        }
+        uint32_t oui = 0;
+        std::string_view name;
+        if (parseRegistryLine(std::string_view(text).substr(position, end - position), oui, name)) {
+            entries.push_back(Entry{oui, name});
+        }
+        position = end + 1;
+    }
+    if (entries.empty()) {
+        throw std::runtime_error(path + ": no OUI assignments found");
+    }
+    adopt(buildImage(entries));
+}
+
+OuiRegistry::~OuiRegistry() = default;
+
+std::string_view OuiRegistry::lookup(uint32_t oui) const {
+    uint32_t slot = slotFor(oui, mask_);
+    while (slots_[slot].oui != EMPTY_SLOT) {
+        if (slots_[slot].oui == oui) {
+            const OuiName& name = names_[slots_[slot].name];
+            return std::string_view(heap_ + name.offset, name.length);
+        }
+        slot = (slot + 1) & mask_;
+    }
+    return std::string_view();
+}
+
+std::string_view OuiRegistry::lookup(std::string_view bssid) const {
+    uint32_t oui = 0;
+    if (!parseOui(bssid, oui) || (oui & 0x020000)) {
+        return std::string_view();
+    }
+    return lookup(oui);
+}
+
+bool OuiRegistry::parseOui(std::string_view bssid, uint32_t& oui) {
+    uint32_t value = 0;
+    size_t digits = 0;
+    for (size_t i = 0; i < bssid.size() && digits < 6; ++i) {
+        const int digit = hexValue(bssid[i]);
+        if (digit >= 0) {
+            value = value << 4 | static_cast<uint32_t>(digit);
+            ++digits;
+        } else if ((bssid[i] != ':' && bssid[i] != '-') || digits % 2 != 0 || digits == 0) {
+            return false;
+        }
+    }
+    if (digits != 6) {
+        return false;
+    }
+    oui = value;
+    return true;
+}
+
+void OuiRegistry::compile(const std::string& sourcePath, const std::string& outputPath) {
+    OuiRegistry registry(sourcePath);
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error(outputPath + ": cannot create OUI database");
+    }
+    out.write(registry.image_.data(), static_cast<std::streamsize>(registry.image_.size()));
+    out.flush();
+    if (!out) {
+        throw std::runtime_error(outputPath + ": write failed");
+    }
+}
+
+void OuiRegistry::adopt(std::string&& image) {
+    image_ = MappedFile(std::move(image));
+    bind("OUI registry");
+}
+
+void OuiRegistry::bind(const std::string& source) {
+    auto fail = [&source](const std::string& message) {
+        throw std::runtime_error(source + ": " + message);
+    };
+
+    const char* data = image_.data();
+    const size_t length = image_.size();
+    if (length < sizeof(OuiHeader)) {
+        fail("too small to be an OUI database");
+    }
+    OuiHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        fail("not an OUI database");
+    }
+    if (header.version != VERSION) {
+        fail("unsupported OUI database version " + std::to_string(header.version));
+    }
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        fail("OUI database written with a different byte order");
+    }
+    const uint64_t slotBytes = uint64_t(header.slotCount) * sizeof(OuiSlot);
+    const uint64_t nameBytes = uint64_t(header.nameCount) * sizeof(OuiName);
+    if (header.slotCount == 0 || (header.slotCount & (header.slotCount - 1)) != 0 ||
+        header.entryCount > header.slotCount / 2) {
+        fail("corrupt OUI table size");
+    }
+    if (header.fileSize != length || sizeof(OuiHeader) + slotBytes + nameBytes + header.heapSize != length) {
+        fail("truncated or oversized OUI database");
+    }
+
+    slots_ = reinterpret_cast<const OuiSlot*>(data + sizeof(OuiHeader));
+    names_ = reinterpret_cast<const OuiName*>(data + sizeof(OuiHeader) + slotBytes);
+    heap_ = data + sizeof(OuiHeader) + slotBytes + nameBytes;
+    mask_ = header.slotCount - 1;
+    entries_ = header.entryCount;
+
+    // Every reference is checked once here so lookups need no bounds checks
+    size_t used = 0;
+    for (uint32_t i = 0; i < header.slotCount; ++i) {
+        if (slots_[i].oui == EMPTY_SLOT) {
+            continue;
+        }
+        if (slots_[i].oui > 0xFFFFFF || slots_[i].name >= header.nameCount) {
+            fail("corrupt OUI entry");
+        }
+        ++used;
+    }
+    for (uint32_t i = 0; i < header.nameCount; ++i) {
+        if (uint64_t(names_[i].offset) + names_[i].length > header.heapSize) {
+            fail("vendor name outside the heap");
+        }
+    }
+    if (used != header.entryCount) {
+        fail("OUI entry count does not match the table");
+    }
+}
+
+} // namespace WifiScanner
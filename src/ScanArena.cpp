@@ -0,0 +1,49 @@
+#include "ScanArena.h"
+#include <algorithm>
+#include <new>
+
+namespace WifiScanner {
+
+void* ScanArena::CountingUpstream::do_allocate(size_t bytes, size_t alignment) {
+    ++allocations;
+    return ::operator new(bytes, std::align_val_t(alignment));
+}
+
+void ScanArena::CountingUpstream::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    ::operator delete(p, bytes, std::align_val_t(alignment));
+}
+
+ScanArena::ScanArena(size_t capacity)
+    : capacity_(std::max<size_t>(capacity, 1)), block_(new std::byte[capacity_]) {
+    monotonic_.emplace(block_.get(), capacity_, &upstream_);
+}
+
+void* ScanArena::do_allocate(size_t bytes, size_t alignment) {
+    bytesUsed_ += bytes;
+    return monotonic_->allocate(bytes, alignment);
+}
+
+void ScanArena::reset() {
+    monotonic_->release();
+    if (upstream_.allocations > 0) {
+        // Headroom for alignment padding, so the same sweep fits next time
+        capacity_ = std::max(capacity_ * 2, bytesUsed_ + bytesUsed_ / 4);
+        block_.reset();
+        block_.reset(new std::byte[capacity_]);
+    }
+    monotonic_.emplace(block_.get(), capacity_, &upstream_);
+    upstream_.allocations = 0;
+    bytesUsed_ = 0;
+}
+
+ScanBuffer::ScanBuffer(size_t capacity) : arena_(capacity) {
+    table_.emplace(&arena_);
+}
+
+NetworkTable& ScanBuffer::begin() {
+    table_.reset();
+    arena_.reset();
+    return table_.emplace(&arena_);
+}
+
+} // namespace WifiScanner
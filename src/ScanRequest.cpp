@@ -0,0 +1,80 @@
+#include "ScanRequest.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace WifiScanner {
+
+ScanRequest ScanRequest::cached() {
+    ScanRequest request;
+    request.mode = ScanMode::CACHED;
+    return request;
+}
+
+ScanRequest ScanRequest::full() {
+    return ScanRequest();
+}
+
+ScanRequest ScanRequest::band(WifiBand band) {
+    ScanRequest request;
+    auto addRange = [&request](int first, int last, int step) {
+        for (int frequency = first; frequency <= last; frequency += step) {
+            request.frequencies.push_back(frequency);
+        }
+    };
+
+    switch (band) {
+        case WifiBand::BAND_2_4GHZ:
+            addRange(2412, 2472, 5);  // Channels 1-13
+            request.frequencies.push_back(2484);
+            break;
+        case WifiBand::BAND_5GHZ:
+            addRange(5180, 5320, 20);  // UNII-1/2: 36-64
+            addRange(5500, 5720, 20);  // UNII-2e: 100-144
+            addRange(5745, 5885, 20);  // UNII-3/4: 149-177
+            break;
+        case WifiBand::BAND_6GHZ:
+            addRange(5955, 7115, 20);  // 20 MHz channels 1-233
+            break;
+        case WifiBand::OTHER:
+            break;
+    }
+    return request;
+}
+
+ScanRequest ScanRequest::channels(const std::vector<int>& channels) {
+    ScanRequest request;
+    for (int channel : channels) {
+        int frequency = 0;
+        if (channel >= 1 && channel <= 13) {
+            frequency = 2407 + channel * 5;
+        } else if (channel == 14) {
+            frequency = 2484;
+        } else if (channel >= 32 && channel <= 196) {
+            frequency = 5000 + channel * 5;
+        } else if (channel >= 2412 && channel <= 7125) {
+            frequency = channel;
+        } else {
+            throw std::runtime_error("Unknown channel: " + std::to_string(channel));
+        }
+        if (std::find(request.frequencies.begin(), request.frequencies.end(), frequency) == request.frequencies.end()) {
+            request.frequencies.push_back(frequency);
+        }
+    }
+    return request;
+}
+
+bool ScanRequest::includes(int frequency) const {
+    return frequencies.empty() ||
+           std::find(frequencies.begin(), frequencies.end(), frequency) != frequencies.end();
+}
+
+std::string ScanRequest::describe() const {
+    std::string description = mode == ScanMode::CACHED ? "cached" : (isTargeted() ? "active" : "full");
+    if (isTargeted()) {
+        description += ", " + std::to_string(frequencies.size()) +
+                       (frequencies.size() == 1 ? " channel" : " channels");
+    }
+    return description;
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,166 @@
+#include "ScoreCache.h"
+#include "NetworkBatch.h"
+#include <algorithm>
+
+namespace WifiScanner {
+
+namespace {
+
+// Slot layout: [ fingerprint tag (55 bits) | valid (1) | referenced (1) | score (7) ]
+// A zero word is an empty slot.
+constexpr uint64_t SCORE_MASK = 0x7F;
+constexpr uint64_t REFERENCED_BIT = 1ull << 7;
+constexpr uint64_t VALID_BIT = 1ull << 8;
+constexpr uint64_t TAG_MASK = ~0x1FFull;
+
+inline uint64_t tagOf(uint64_t fingerprint) {
+    return fingerprint & TAG_MASK;
+}
+
+inline uint64_t mix64(uint64_t x) {
+    // splitmix64 finalizer
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    return x;
+}
+
+inline uint64_t pack(uint32_t low, uint32_t high) {
+    return static_cast<uint64_t>(low) | (static_cast<uint64_t>(high) << 32);
+}
+
+} // namespace
+
+ScoreCache::ScoreCache(size_t capacity) {
+    // Round up to a power-of-two number of sets so the set index is a mask
+    size_t sets = 1;
+    while (sets * WAYS < capacity) {
+        sets <<= 1;
+    }
+    setCount_ = sets;
+    slots_.reset(new std::atomic<uint64_t>[setCount_ * WAYS]);
+    hands_.reset(new std::atomic<uint32_t>[setCount_]);
+    clear();
+}
+
+bool ScoreCache::lookup(uint64_t fingerprint, int& score) {
+    std::atomic<uint64_t>* set = &slots_[setIndex(fingerprint) * WAYS];
+    const uint64_t tag = tagOf(fingerprint);
+
+    for (size_t way = 0; way < WAYS; ++way) {
+        uint64_t entry = set[way].load(std::memory_order_relaxed);
+        if ((entry & VALID_BIT) && tagOf(entry) == tag) {
+            if (!(entry & REFERENCED_BIT)) {
+                set[way].fetch_or(REFERENCED_BIT, std::memory_order_relaxed);
+            }
+            score = static_cast<int>(entry & SCORE_MASK);
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void ScoreCache::insert(uint64_t fingerprint, int score) {
+    const size_t index = setIndex(fingerprint);
+    std::atomic<uint64_t>* set = &slots_[index * WAYS];
+    const uint64_t tag = tagOf(fingerprint);
+    const uint64_t entry = tag | VALID_BIT | REFERENCED_BIT |
+                           static_cast<uint64_t>(std::max(0, std::min(100, score)));
+
+    // Refresh an existing entry or claim an empty way
+    for (size_t way = 0; way < WAYS; ++way) {
+        uint64_t current = set[way].load(std::memory_order_relaxed);
+        if (current == 0) {
+            if (set[way].compare_exchange_strong(current, entry, std::memory_order_relaxed)) {
+                insertions_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+        if ((current & VALID_BIT) && tagOf(current) == tag) {
+            set[way].store(entry, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    // CLOCK sweep: two full turns guarantee a victim unless other threads keep
+    // re-referencing the set, in which case the insert is simply dropped
+    for (size_t step = 0; step < 2 * WAYS; ++step) {
+        size_t way = hands_[index].fetch_add(1, std::memory_order_relaxed) % WAYS;
+        uint64_t current = set[way].load(std::memory_order_relaxed);
+        if (current & REFERENCED_BIT) {
+            set[way].compare_exchange_strong(current, current & ~REFERENCED_BIT, std::memory_order_relaxed);
+            continue;
+        }
+        if (set[way].compare_exchange_strong(current, entry, std::memory_order_relaxed)) {
+            insertions_.fetch_add(1, std::memory_order_relaxed);
+            if (current != 0) {
+                evictions_.fetch_add(1, std::memory_order_relaxed);
+            }
+            return;
+        }
+    }
+}
+
+void ScoreCache::clear() {
+    for (size_t i = 0; i < setCount_ * WAYS; ++i) {
+        slots_[i].store(0, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < setCount_; ++i) {
+        hands_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+ScoreCacheStats ScoreCache::stats() const {
+    ScoreCacheStats stats;
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.insertions = insertions_.load(std::memory_order_relaxed);
+    stats.evictions = evictions_.load(std::memory_order_relaxed);
+    stats.capacity = capacity();
+    for (size_t i = 0; i < capacity(); ++i) {
+        if (slots_[i].load(std::memory_order_relaxed) & VALID_BIT) {
+            ++stats.size;
+        }
+    }
+    return stats;
+}
+
+uint64_t ScoreCache::fingerprint(const NetworkInfo& network) {
+    return fingerprint(network.securityType, network.signalStrength, network.channel, network.frequency,
+                       network.channelWidth, network.maxDataRate, network.beaconInterval,
+                       packNetworkFlags(network), network.vendorId, network.vendor);
+}
+
+uint64_t ScoreCache::fingerprint(const NetworkTable::Row& network) {
+    return fingerprint(network.securityType(), network.signalStrength(), network.channel(), network.frequency(),
+                       network.channelWidth(), network.maxDataRate(), network.beaconInterval(),
+                       network.flags(), network.vendorId(), network.vendor());
+}
+
+uint64_t ScoreCache::fingerprint(SecurityType securityType, int signalStrength, int channel, int frequency,
+                                 int channelWidth, int maxDataRate, int beaconInterval, uint32_t flags,
+                                 uint16_t vendorId, std::string_view vendor) {
+    // Interned vendors hash by ID; otherwise the name is hashed in place with FNV-1a
+    uint64_t vendorHash = 0xCBF29CE484222325ull;
+    if (vendorId != 0) {
+        vendorHash = mix64(vendorHash ^ vendorId);
+    } else {
+        for (unsigned char c : vendor) {
+            vendorHash ^= c;
+            vendorHash *= 0x100000001B3ull;
+        }
+    }
+
+    uint64_t hash = mix64(pack(static_cast<uint32_t>(securityType), static_cast<uint32_t>(signalStrength)));
+    hash = mix64(hash ^ pack(static_cast<uint32_t>(channel), static_cast<uint32_t>(frequency)));
+    hash = mix64(hash ^ pack(static_cast<uint32_t>(channelWidth), static_cast<uint32_t>(maxDataRate)));
+    hash = mix64(hash ^ pack(static_cast<uint32_t>(beaconInterval), flags));
+    return mix64(hash ^ vendorHash);
+}
+
+} // namespace WifiScanner
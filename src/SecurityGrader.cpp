@@ -1,69 +1,324 @@
 #include "SecurityGrader.h"
+#include "NetworkTable.h"
+#include "CompactNetwork.h"
+#include "ScoringTables.h"
+#include "ThreadPool.h"
+#include "Tracing.h"
+#include "VendorRegistry.h"
 #include <algorithm>
-#include <regex>
-#include <unordered_map>
-#include <chrono>
-#include <iostream>
 #include <cmath>
+#include <cctype>
+#include <cstring>
 
 namespace WifiScanner {
 
+namespace {
+
+// Case-insensitive substring search against a lowercase needle, without copying
+bool containsIgnoreCase(const std::string& haystack, const char* needle) {
+    const size_t needleLength = std::strlen(needle);
+    if (needleLength > haystack.size()) {
+        return false;
+    }
+    for (size_t start = 0; start + needleLength <= haystack.size(); ++start) {
+        size_t i = 0;
+        while (i < needleLength &&
+               std::tolower(static_cast<unsigned char>(haystack[start + i])) == needle[i]) {
+            ++i;
+        }
+        if (i == needleLength) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// A table row under the NetworkInfo field names, for breakdownFields()
+struct RowFields {
+    explicit RowFields(const NetworkTable::Row& row)
+        : securityType(row.securityType()), signalStrength(row.signalStrength()), channel(row.channel()),
+          frequency(row.frequency()), channelWidth(row.channelWidth()), maxDataRate(row.maxDataRate()),
+          beaconInterval(row.beaconInterval()), flags(row.flags()) {}
+
+    SecurityType securityType;
+    int signalStrength;
+    int channel;
+    int frequency;
+    int channelWidth;
+    int maxDataRate;
+    int beaconInterval;
+    uint32_t flags;
+};
+
+inline uint32_t packNetworkFlags(const RowFields& network) {
+    return network.flags;
+}
+
+} // namespace
+
 SecurityGrader::SecurityGrader() {
     // Initialize any caching or optimization structures
 }
 
+SecurityGrader::SecurityGrader(size_t cacheCapacity) : scoreCache_(cacheCapacity) {
+}
+
+int SecurityGrader::scoreNetwork(const NetworkInfo& network) const {
+    return calculateSecurityScore(network);
+}
+
 SecurityGrade SecurityGrader::gradeNetwork(const NetworkInfo& network) const {
-    int score = calculateSecurityScore(network);
+    const int score = calculateSecurityScore(network);
+    return profile_ ? profile_->grade(score) : gradeFromScore(score);
+}
+
+int SecurityGrader::scoreNetwork(const CompactNetwork& network) const {
+    WIFI_TRACE_COUNT(NETWORKS_SCORED, 1);
+    return scoreFields(network, VendorRegistry::instance().score(network.vendorId));
+}
+
+SecurityGrade SecurityGrader::gradeNetwork(const CompactNetwork& network) const {
+    const int score = scoreNetwork(network);
+    return profile_ ? profile_->grade(score) : gradeFromScore(score);
+}
+
+void SecurityGrader::setProfile(std::shared_ptr<const ProfileEvaluator> profile) {
+    profile_ = std::move(profile);
+    scoreCache_.clear();
+}
+
+ScoreBreakdown SecurityGrader::scoreBreakdown(const NetworkInfo& network) const {
+    WIFI_TRACE_COUNT(NETWORKS_SCORED, 1);
+    return breakdownFields(network, calculateVendorScore(network));
+}
+
+ScoreBreakdown SecurityGrader::scoreBreakdown(const CompactNetwork& network) const {
+    WIFI_TRACE_COUNT(NETWORKS_SCORED, 1);
+    return breakdownFields(network, VendorRegistry::instance().score(network.vendorId));
+}
+
+ScoreBreakdown SecurityGrader::scoreBreakdown(const NetworkTable::Row& network) const {
+    WIFI_TRACE_COUNT(NETWORKS_SCORED, 1);
+    return breakdownFields(RowFields(network), network.vendorScore());
+}
+
+template <typename Network>
+ScoreBreakdown SecurityGrader::breakdownFields(const Network& network, int vendorScore) const {
+    using namespace ScoringTables;
+    
+    const uint32_t flags = packNetworkFlags(network);
+    
+    ScoreBreakdown breakdown;
+    breakdown.encryption = ENCRYPTION[encryptionIndex(static_cast<int>(network.securityType))];
+    breakdown.authentication = AUTHENTICATION[authenticationIndex(flags)];
+    breakdown.channel = CHANNEL[channelIndex(network.frequency, network.channelWidth, network.channel)];
+    breakdown.feature = FEATURE[featureIndex(flags)];
+    breakdown.configuration = CONFIGURATION[configurationIndex(network.signalStrength, network.maxDataRate, flags)];
+    breakdown.vendor = static_cast<int16_t>(vendorScore);
+    breakdown.advanced = ADVANCED[advancedIndex(flags, network.beaconInterval)];
+    
+    if (profile_) {
+        breakdown.score = static_cast<int16_t>(profile_->score(breakdown));
+        breakdown.grade = profile_->grade(breakdown.score);
+        return breakdown;
+    }
     
-    if (score >= 70) return SecurityGrade::EXCELLENT;
-    if (score >= 55) return SecurityGrade::GOOD;
-    if (score >= 40) return SecurityGrade::OKAY;
-    if (score >= 20) return SecurityGrade::BAD;
-    return SecurityGrade::VERY_BAD;
+    breakdown.score = static_cast<int16_t>(builtinScore(breakdown));
+    breakdown.grade = gradeFromScore(breakdown.score);
+    return breakdown;
+}
+
+int SecurityGrader::builtinScore(const ScoreBreakdown& components) {
+    using namespace ScoringTables;
+    
+    // Same products and summation order as calculateSecurityScore()
+    double score = 0.0;
+    score += components.encryption * ENCRYPTION_WEIGHT;
+    score += components.authentication * AUTHENTICATION_WEIGHT;
+    score += components.channel * CHANNEL_WEIGHT;
+    score += components.feature * FEATURE_WEIGHT;
+    score += components.configuration * CONFIGURATION_WEIGHT;
+    score += components.vendor * VENDOR_WEIGHT;
+    score += components.advanced * ADVANCED_WEIGHT;
+    score = std::max(0.0, std::min(100.0, score));
+    return static_cast<int>(std::round(score));
 }
 
 std::vector<NetworkInfo> SecurityGrader::gradeAndSortNetworks(const std::vector<NetworkInfo>& networks) const {
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    std::vector<NetworkInfo> sortedNetworks = networks;
-    
-    // Enhanced sorting with multiple criteria
-    std::sort(sortedNetworks.begin(), sortedNetworks.end(),
-        [this](const NetworkInfo& a, const NetworkInfo& b) {
-            int scoreA = calculateSecurityScore(a);
-            int scoreB = calculateSecurityScore(b);
-            
-            // If security scores are close, prioritize other factors
-            if (std::abs(scoreA - scoreB) <= 5) {
-                // Prioritize non-rogue APs
-                if (a.isRogueAP != b.isRogueAP) {
-                    return !a.isRogueAP; // Non-rogue first
-                }
-                
-                // Prioritize enterprise networks
-                if (a.isEnterprise != b.isEnterprise) {
-                    return a.isEnterprise; // Enterprise first
-                }
-                
-                // Prioritize networks with PMF
-                if (a.supportsPMF != b.supportsPMF) {
-                    return a.supportsPMF; // PMF first
-                }
+    return gradeAndSortNetworks(networks, ExecutionPolicy::sequential());
+}
+
+std::vector<NetworkInfo> SecurityGrader::gradeAndSortNetworks(const std::vector<NetworkInfo>& networks,
+                                                              ExecutionPolicy policy) const {
+    return sortByRanking(networks, policy);
+}
+
+std::vector<CompactNetwork> SecurityGrader::gradeAndSortNetworks(const std::vector<CompactNetwork>& networks,
+                                                                 ExecutionPolicy policy) const {
+    return sortByRanking(networks, policy);
+}
+
+std::vector<uint32_t> SecurityGrader::rankNetworks(const NetworkTable& table, ExecutionPolicy policy) const {
+    WIFI_TRACE_SCOPE(GRADE_AND_SORT);
+    WIFI_TRACE_COUNT(NETWORKS_SORTED, table.size());
+    
+    // The table's columns are already a batch, so chunks score them in place
+    const NetworkBatchView view = table.view();
+    const std::vector<uint64_t> keys = sortedRankingKeys(table.size(), policy,
+        [&view](size_t begin, size_t end, NetworkBatch&) { return view.rows(begin, end); });
+    
+    std::vector<uint32_t> order(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        order[i] = rankingKeyIndex(keys[i]);
+    }
+    return order;
+}
+
+NetworkTable SecurityGrader::gradeAndSortNetworks(const NetworkTable& table, ExecutionPolicy policy) const {
+    return table.select(rankNetworks(table, policy));
+}
+
+template <typename Network>
+std::vector<Network> SecurityGrader::sortByRanking(const std::vector<Network>& networks,
+                                                   ExecutionPolicy policy) const {
+    WIFI_TRACE_SCOPE(GRADE_AND_SORT);
+    WIFI_TRACE_COUNT(NETWORKS_SORTED, networks.size());
+    
+    const size_t count = networks.size();
+    const std::vector<uint64_t> keys = sortedRankingKeys(count, policy,
+        [&networks](size_t begin, size_t end, NetworkBatch& batch) {
+            batch.reserve(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                batch.append(networks[i]);
             }
-            
-            return scoreA > scoreB; // Primary sort by security score
+            return batch.view();
         });
     
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    const size_t threads = chunkCount(count, policy);
+    std::vector<Network> sortedNetworks(count);
+    ThreadPool::shared().parallelFor(threads, [&](size_t chunk) {
+        const size_t begin = count * chunk / threads;
+        const size_t end = count * (chunk + 1) / threads;
+        for (size_t i = begin; i < end; ++i) {
+            sortedNetworks[i] = networks[rankingKeyIndex(keys[i])];
+        }
+    });
     
-    // Performance logging (could be made configurable)
-    if (networks.size() > 100) {
-        std::cout << "Sorted " << networks.size() << " networks in " 
-                  << duration.count() << " microseconds" << std::endl;
+    return sortedNetworks;
+}
+
+size_t SecurityGrader::chunkCount(size_t count, ExecutionPolicy policy) {
+    size_t threads = policy.threads == 0 ? ThreadPool::hardwareThreads() : policy.threads;
+    return std::max<size_t>(1, std::min(threads, count / MIN_PARALLEL_CHUNK));
+}
+
+template <typename ChunkRows>
+std::vector<uint64_t> SecurityGrader::sortedRankingKeys(size_t count, ExecutionPolicy policy,
+                                                        ChunkRows chunkRows) const {
+    const size_t threads = chunkCount(count, policy);
+    ThreadPool& pool = ThreadPool::shared();
+    
+    // Each chunk scores its rows with the batch kernels and sorts its own keys.
+    // Keys carry the global input position, so the merged order is identical
+    // to sorting everything at once.
+    std::vector<std::vector<uint64_t>> runs(threads);
+    pool.parallelFor(threads, [&](size_t chunk) {
+        const size_t begin = count * chunk / threads;
+        const size_t end = count * (chunk + 1) / threads;
+        
+        NetworkBatch scratch;
+        const NetworkBatchView rows = chunkRows(begin, end, scratch);
+        std::vector<int> scores(end - begin);
+        gradeBatch(rows, scores.data(), nullptr);
+        
+        // Pack score, tie-break tiers and input position into one key per network
+        std::vector<uint64_t>& keys = runs[chunk];
+        {
+            WIFI_TRACE_SCOPE(RANKING_KEYS);
+            keys.resize(end - begin);
+            for (size_t i = 0; i < keys.size(); ++i) {
+                keys[i] = makeRankingKey(scores[i], rows.flags[i], static_cast<uint32_t>(begin + i));
+            }
+        }
+        
+        radixSortKeys(keys);
+    });
+    
+    // Merge neighbouring runs pairwise until one is left
+    while (runs.size() > 1) {
+        WIFI_TRACE_SCOPE(MERGE_RUNS);
+        std::vector<std::vector<uint64_t>> merged((runs.size() + 1) / 2);
+        pool.parallelFor(merged.size(), [&](size_t pair) {
+            if (2 * pair + 1 == runs.size()) {
+                merged[pair] = std::move(runs[2 * pair]);
+                return;
+            }
+            const auto& left = runs[2 * pair];
+            const auto& right = runs[2 * pair + 1];
+            merged[pair].resize(left.size() + right.size());
+            std::merge(left.begin(), left.end(), right.begin(), right.end(), merged[pair].begin());
+        });
+        runs = std::move(merged);
     }
     
-    return sortedNetworks;
+    return std::move(runs.front());
+}
+
+uint64_t SecurityGrader::makeRankingKey(int score, uint32_t flags, uint32_t index) {
+    // Keys sort ascending, so every field is stored so that "better" is smaller:
+    //   bits 48-55  inverted score band (5-point bands, best band first)
+    //   bit  47     rogue AP (non-rogue first)
+    //   bit  46     personal authentication (enterprise first)
+    //   bit  45     no PMF (PMF first)
+    //   bits 32-38  inverted exact score
+    //   bits 0-31   input position, so equal networks keep their scan order
+    // The exact score breaks ties inside a band below the tiers, which keeps the
+    // "close scores prefer non-rogue/enterprise/PMF" rule a strict weak ordering.
+    const uint64_t clamped = static_cast<uint64_t>(std::max(0, std::min(100, score)));
+    const uint64_t band = (100 / RANKING_BAND_WIDTH) - clamped / RANKING_BAND_WIDTH;
+    const uint64_t rogue = (flags & FLAG_ROGUE_AP) ? 1 : 0;
+    const uint64_t personal = (flags & FLAG_ENTERPRISE) ? 0 : 1;
+    const uint64_t noPmf = (flags & FLAG_PMF) ? 0 : 1;
+    const uint64_t inverseScore = 100 - clamped;
+    
+    return (band << 48) | (rogue << 47) | (personal << 46) | (noPmf << 45) |
+           (inverseScore << 32) | index;
+}
+
+uint32_t SecurityGrader::rankingKeyIndex(uint64_t key) {
+    return static_cast<uint32_t>(key & 0xFFFFFFFFu);
+}
+
+void SecurityGrader::radixSortKeys(std::vector<uint64_t>& keys) {
+    WIFI_TRACE_SCOPE(SORT_KEYS);
+    
+    if (keys.size() < 2) {
+        return;
+    }
+    
+    // LSD radix sort, one byte per pass. Bytes that are identical across all
+    // keys (e.g. high index bytes for small scans) are skipped.
+    std::vector<uint64_t> scratch(keys.size());
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t counts[256] = {};
+        for (uint64_t key : keys) {
+            ++counts[(key >> shift) & 0xFF];
+        }
+        if (counts[(keys[0] >> shift) & 0xFF] == keys.size()) {
+            continue;
+        }
+        
+        size_t offset = 0;
+        for (size_t& count : counts) {
+            size_t bucketSize = count;
+            count = offset;
+            offset += bucketSize;
+        }
+        for (uint64_t key : keys) {
+            scratch[counts[(key >> shift) & 0xFF]++] = key;
+        }
+        keys.swap(scratch);
+    }
 }
 
 std::string SecurityGrader::gradeToString(SecurityGrade grade) {
@@ -92,52 +347,51 @@ std::string SecurityGrader::securityTypeToString(SecurityType type) {
 }
 
 int SecurityGrader::calculateSecurityScore(const NetworkInfo& network) const {
-    double score = 0.0;
+    WIFI_TRACE_COUNT(NETWORKS_SCORED, 1);
+    return scoreFields(network, calculateVendorScore(network));
+}
+
+template <typename Network>
+int SecurityGrader::scoreFields(const Network& network, int vendorComponent) const {
+    using namespace ScoringTables;
+    
+    if (profile_) {
+        return profile_->score(network, vendorComponent);
+    }
+    
+    // Every component except vendor is a table load; see ScoringTables.h
+    const uint32_t flags = packNetworkFlags(network);
     
     // Base score based on security type (35% of total score)
-    double encryptionScore = calculateEncryptionScore(network.securityType) * 0.35;
-    score += encryptionScore;
+    double encryptionScore = WEIGHTED_ENCRYPTION[encryptionIndex(static_cast<int>(network.securityType))];
     
     // Enterprise vs Personal authentication (15% of total score)
-    double authScore = calculateAuthenticationScore(network) * 0.15;
-    score += authScore;
+    double authScore = WEIGHTED_AUTHENTICATION[authenticationIndex(flags)];
     
     // Channel width and frequency considerations (10% of total score)
-    double channelScore = calculateChannelScore(network) * 0.10;
-    score += channelScore;
+    double channelScore = WEIGHTED_CHANNEL[channelIndex(network.frequency, network.channelWidth, network.channel)];
     
     // Security features and protocols (20% of total score)
-    double featureScore = calculateFeatureScore(network) * 0.20;
-    score += featureScore;
+    double featureScore = WEIGHTED_FEATURE[featureIndex(flags)];
     
     // Network configuration and behavior (10% of total score)
-    double configScore = calculateConfigurationScore(network) * 0.10;
-    score += configScore;
+    double configScore = WEIGHTED_CONFIGURATION[configurationIndex(network.signalStrength, network.maxDataRate, flags)];
     
     // Vendor and manufacturer considerations (5% of total score)
-    double vendorScore = calculateVendorScore(network) * 0.05;
-    score += vendorScore;
+    double vendorScore = vendorComponent * VENDOR_WEIGHT;
     
     // Advanced security analysis (5% of total score)
-    double advancedScore = calculateAdvancedSecurityScore(network) * 0.05;
-    score += advancedScore;
+    double advancedScore = WEIGHTED_ADVANCED[advancedIndex(flags, network.beaconInterval)];
     
-    // Debug output for first few networks
-    static int debugCount = 0;
-    if (debugCount < 3) {
-        std::cout << "DEBUG Network " << debugCount << " (" << network.ssid << "):" << std::endl;
-        std::cout << "  Security Type: " << (int)network.securityType << std::endl;
-        std::cout << "  Encryption Score: " << encryptionScore << " (base: " << calculateEncryptionScore(network.securityType) << ")" << std::endl;
-        std::cout << "  Auth Score: " << authScore << std::endl;
-        std::cout << "  Channel Score: " << channelScore << std::endl;
-        std::cout << "  Feature Score: " << featureScore << std::endl;
-        std::cout << "  Config Score: " << configScore << std::endl;
-        std::cout << "  Vendor Score: " << vendorScore << std::endl;
-        std::cout << "  Advanced Score: " << advancedScore << std::endl;
-        std::cout << "  Total Score: " << score << std::endl;
-        std::cout << std::endl;
-        debugCount++;
-    }
+    // Summed in the same order as the weighted reference formula
+    double score = 0.0;
+    score += encryptionScore;
+    score += authScore;
+    score += channelScore;
+    score += featureScore;
+    score += configScore;
+    score += vendorScore;
+    score += advancedScore;
     
     // Ensure score is within bounds and round to nearest integer
     score = std::max(0.0, std::min(100.0, score));
@@ -263,34 +517,39 @@ int SecurityGrader::calculateConfigurationScore(const NetworkInfo& network) cons
 }
 
 int SecurityGrader::calculateVendorScore(const NetworkInfo& network) const {
+    // Interned vendors were classified once by VendorRegistry
+    if (network.vendorId != VendorRegistry::NO_VENDOR) {
+        return VendorRegistry::instance().score(network.vendorId);
+    }
+    return vendorScore(network.vendor);
+}
+
+int SecurityGrader::vendorScore(const std::string& vendorName) {
     int score = 0;
     
-    if (network.vendor.empty()) {
+    if (vendorName.empty()) {
         return 0; // No vendor info available
     }
     
     // Some vendors are known for better security practices
-    std::string vendor = network.vendor;
-    std::transform(vendor.begin(), vendor.end(), vendor.begin(), ::tolower);
-    
     // Enterprise-focused vendors often have better security
-    if (vendor.find("cisco") != std::string::npos ||
-        vendor.find("aruba") != std::string::npos ||
-        vendor.find("ruckus") != std::string::npos ||
-        vendor.find("ubiquiti") != std::string::npos) {
+    if (containsIgnoreCase(vendorName, "cisco") ||
+        containsIgnoreCase(vendorName, "aruba") ||
+        containsIgnoreCase(vendorName, "ruckus") ||
+        containsIgnoreCase(vendorName, "ubiquiti")) {
         score += 5;
     }
     
     // Consumer vendors with good security track records
-    else if (vendor.find("asus") != std::string::npos ||
-             vendor.find("netgear") != std::string::npos ||
-             vendor.find("tp-link") != std::string::npos) {
+    else if (containsIgnoreCase(vendorName, "asus") ||
+             containsIgnoreCase(vendorName, "netgear") ||
+             containsIgnoreCase(vendorName, "tp-link")) {
         score += 2;
     }
     
     // Some vendors have had security issues in the past
-    else if (vendor.find("d-link") != std::string::npos ||
-             vendor.find("linksys") != std::string::npos) {
+    else if (containsIgnoreCase(vendorName, "d-link") ||
+             containsIgnoreCase(vendorName, "linksys")) {
         score -= 2;
     }
     
@@ -337,20 +596,17 @@ int SecurityGrader::calculateAdvancedSecurityScore(const NetworkInfo& network) c
 
 // Performance optimization: Cache for repeated calculations
 int SecurityGrader::getCachedScore(const NetworkInfo& network) const {
-    // Create a cache key from network characteristics
-    std::string key = network.ssid + "|" + 
-                     std::to_string(static_cast<int>(network.securityType)) + "|" +
-                     std::to_string(network.isEnterprise) + "|" +
-                     std::to_string(network.supportsPMF);
+    // Key on every scoring input so networks that differ in any factor never share an entry
+    uint64_t key = ScoreCache::fingerprint(network);
     
-    auto it = scoreCache_.find(key);
-    if (it != scoreCache_.end()) {
-        return it->second;
+    int score;
+    if (scoreCache_.lookup(key, score)) {
+        return score;
     }
     
     // Calculate and cache the score
-    int score = calculateSecurityScore(network);
-    scoreCache_[key] = score;
+    score = calculateSecurityScore(network);
+    scoreCache_.insert(key, score);
     
     return score;
 }
@@ -359,4 +615,8 @@ void SecurityGrader::clearCache() const {
     scoreCache_.clear();
 }
 
+ScoreCacheStats SecurityGrader::getCacheStats() const {
+    return scoreCache_.stats();
+}
+
 } // namespace WifiScanner
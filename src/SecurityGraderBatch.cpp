@@ -0,0 +1,437 @@
+#include "SecurityGrader.h"
+#include "ScoringTables.h"
+#include "Tracing.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define WIFI_SCANNER_X86_SIMD 1
+#include <immintrin.h>
+#define WIFI_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace WifiScanner {
+
+namespace {
+
+using namespace ScoringTables;
+
+// Weights and grade thresholds applied by the SIMD kernels. Without a profile
+// the built-in double weights are used, so results stay bit-identical to
+// calculateSecurityScore(); a profile's components are summed in fixed point.
+struct KernelWeights {
+    const ProfileEvaluator::FixedWeights* fixed = nullptr;
+    int thresholds[4] = {20, 40, 55, 70};  // Lowest BAD, OKAY, GOOD, EXCELLENT score
+
+    KernelWeights() = default;
+    explicit KernelWeights(const ProfileEvaluator& profile)
+        : fixed(&profile.weights()),
+          thresholds{profile.profile().bad, profile.profile().okay, profile.profile().good,
+                     profile.profile().excellent} {}
+};
+
+// Table-driven row score; the same loads and adds as calculateSecurityScore()
+int scoreRow(const NetworkBatchView& batch, size_t i) {
+    const uint32_t flags = batch.flags[i];
+
+    double score = 0.0;
+    score += WEIGHTED_ENCRYPTION[encryptionIndex(batch.securityType[i])];
+    score += WEIGHTED_AUTHENTICATION[authenticationIndex(flags)];
+    score += WEIGHTED_CHANNEL[channelIndex(batch.frequency[i], batch.channelWidth[i], batch.channel[i])];
+    score += WEIGHTED_FEATURE[featureIndex(flags)];
+    score += WEIGHTED_CONFIGURATION[configurationIndex(batch.signalStrength[i], batch.maxDataRate[i], flags)];
+    score += batch.vendorScore[i] * VENDOR_WEIGHT;
+    score += WEIGHTED_ADVANCED[advancedIndex(flags, batch.beaconInterval[i])];
+
+    score = std::max(0.0, std::min(100.0, score));
+    return static_cast<int>(std::round(score));
+}
+
+void gradeScalar(const NetworkBatchView& batch, size_t begin, int* scores, SecurityGrade* grades) {
+    for (size_t i = begin; i < batch.size; ++i) {
+        int score = scoreRow(batch, i);
+        if (scores) scores[i] = score;
+        if (grades) grades[i] = SecurityGrader::gradeFromScore(score);
+    }
+}
+
+#ifdef WIFI_SCANNER_X86_SIMD
+
+// Flag bits behind featureIndex() bits 1-3 and advancedIndex()'s threat count
+constexpr uint32_t FEATURE_FLAGS = FLAG_WPS | FLAG_PMF | FLAG_OWE;
+constexpr uint32_t THREAT_FLAGS = FLAG_ROGUE_AP | FLAG_EVIL_TWIN | FLAG_TYPO_SQUATTING | FLAG_RESPONDS_PROBES |
+                                  FLAG_ANOMALOUS;
+
+// ---- SSE4.2: four networks per iteration ----
+
+// All-ones lanes where value >= bound
+WIFI_TARGET("sse4.2") inline __m128i atLeast128(__m128i value, int bound) {
+    return _mm_cmpgt_epi32(value, _mm_set1_epi32(bound - 1));
+}
+
+// Number of set masks per lane: each all-ones lane counts -1
+WIFI_TARGET("sse4.2") inline __m128i countMasks128(__m128i a, __m128i b) {
+    return _mm_sub_epi32(_mm_setzero_si128(), _mm_add_epi32(a, b));
+}
+
+// `result` in lanes where value == target, 0 elsewhere
+WIFI_TARGET("sse4.2") inline __m128i whereEqual128(__m128i value, int target, int result) {
+    return _mm_and_si128(_mm_cmpeq_epi32(value, _mm_set1_epi32(target)), _mm_set1_epi32(result));
+}
+
+WIFI_TARGET("sse4.2") inline __m128i times3_128(__m128i value) {
+    return _mm_add_epi32(_mm_slli_epi32(value, 1), value);
+}
+
+WIFI_TARGET("sse4.2") inline __m128i bits128(__m128i flags, uint32_t mask, int shift) {
+    return _mm_srli_epi32(_mm_and_si128(flags, _mm_set1_epi32(static_cast<int>(mask))), shift);
+}
+
+// table[index] per lane; SSE has no gather, so each lane is a scalar load
+template <size_t N>
+WIFI_TARGET("sse4.2") inline __m128i lookup128(const std::array<int32_t, N>& table, __m128i index) {
+    return _mm_setr_epi32(table[_mm_cvtsi128_si32(index)], table[_mm_extract_epi32(index, 1)],
+                          table[_mm_extract_epi32(index, 2)], table[_mm_extract_epi32(index, 3)]);
+}
+
+// Round-half-away-from-zero for non-negative doubles, matching std::round
+WIFI_TARGET("sse4.2") inline __m128d roundPositive128(__m128d x) {
+    const __m128d whole = _mm_floor_pd(x);
+    const __m128d up = _mm_cmpge_pd(_mm_sub_pd(x, whole), _mm_set1_pd(0.5));
+    return _mm_add_pd(whole, _mm_and_pd(up, _mm_set1_pd(1.0)));
+}
+
+// Widen lanes 0-1 (half == 0) or 2-3 (half == 1) to double
+WIFI_TARGET("sse4.2") inline __m128d toDouble128(__m128i v, int half) {
+    return _mm_cvtepi32_pd(half ? _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)) : v);
+}
+
+WIFI_TARGET("sse4.2") inline __m128i combine128(__m128i enc, __m128i auth, __m128i ch, __m128i feat,
+                                                __m128i cfg, __m128i vendor, __m128i adv, int half) {
+    __m128d score = _mm_mul_pd(toDouble128(enc, half), _mm_set1_pd(ENCRYPTION_WEIGHT));
+    score = _mm_add_pd(score, _mm_mul_pd(toDouble128(auth, half), _mm_set1_pd(AUTHENTICATION_WEIGHT)));
+    score = _mm_add_pd(score, _mm_mul_pd(toDouble128(ch, half), _mm_set1_pd(CHANNEL_WEIGHT)));
+    score = _mm_add_pd(score, _mm_mul_pd(toDouble128(feat, half), _mm_set1_pd(FEATURE_WEIGHT)));
+    score = _mm_add_pd(score, _mm_mul_pd(toDouble128(cfg, half), _mm_set1_pd(CONFIGURATION_WEIGHT)));
+    score = _mm_add_pd(score, _mm_mul_pd(toDouble128(vendor, half), _mm_set1_pd(VENDOR_WEIGHT)));
+    score = _mm_add_pd(score, _mm_mul_pd(toDouble128(adv, half), _mm_set1_pd(ADVANCED_WEIGHT)));
+    score = _mm_max_pd(_mm_setzero_pd(), _mm_min_pd(_mm_set1_pd(100.0), score));
+    return _mm_cvttpd_epi32(roundPositive128(score));
+}
+
+// Fixed-point weighted sum, clamped and rounded half up. Totals stay below 2^24,
+// so the float division is exact on multiples of SCALE and can never round a
+// fraction up to the next integer; truncating it is an exact floor division.
+WIFI_TARGET("sse4.2") inline __m128i combineFixed128(__m128i enc, __m128i auth, __m128i ch, __m128i feat,
+                                                     __m128i cfg, __m128i vendor, __m128i adv,
+                                                     const ProfileEvaluator::FixedWeights& w) {
+    __m128i total = _mm_mullo_epi32(enc, _mm_set1_epi32(w.encryption));
+    total = _mm_add_epi32(total, _mm_mullo_epi32(auth, _mm_set1_epi32(w.authentication)));
+    total = _mm_add_epi32(total, _mm_mullo_epi32(ch, _mm_set1_epi32(w.channel)));
+    total = _mm_add_epi32(total, _mm_mullo_epi32(feat, _mm_set1_epi32(w.feature)));
+    total = _mm_add_epi32(total, _mm_mullo_epi32(cfg, _mm_set1_epi32(w.configuration)));
+    total = _mm_add_epi32(total, _mm_mullo_epi32(vendor, _mm_set1_epi32(w.vendor)));
+    total = _mm_add_epi32(total, _mm_mullo_epi32(adv, _mm_set1_epi32(w.advanced)));
+    total = _mm_max_epi32(_mm_setzero_si128(), _mm_min_epi32(total, _mm_set1_epi32(100 * ProfileEvaluator::SCALE)));
+    total = _mm_add_epi32(total, _mm_set1_epi32(ProfileEvaluator::SCALE / 2));
+    return _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(total), _mm_set1_ps(ProfileEvaluator::SCALE)));
+}
+
+WIFI_TARGET("sse4.2") size_t gradeSse42(const NetworkBatchView& batch, int* scores, SecurityGrade* grades,
+                                        const KernelWeights& weights) {
+    const __m128i zero = _mm_setzero_si128();
+
+    // Each component computes its ScoringTables index, with the same arithmetic
+    // as the scalar *Index() functions, and loads the cell
+    size_t i = 0;
+    for (; i + 4 <= batch.size; i += 4) {
+        const __m128i flags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.flags + i));
+        const __m128i enterprise = bits128(flags, FLAG_ENTERPRISE, 1);
+
+        __m128i type = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.securityType + i));
+        type = _mm_min_epu32(type, _mm_set1_epi32(static_cast<int>(ENCRYPTION_CELLS - 1)));
+        const __m128i enc = lookup128(WIDE_ENCRYPTION, type);
+
+        const __m128i auth = lookup128(WIDE_AUTHENTICATION, _mm_or_si128(enterprise, bits128(flags, FLAG_GUEST, 4)));
+
+        const __m128i freq = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.frequency + i));
+        const __m128i width = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.channelWidth + i));
+        const __m128i chan = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.channel + i));
+        const __m128i band = _mm_sub_epi32(countMasks128(atLeast128(freq, BAND_2_4GHZ_START),
+                                                         atLeast128(freq, BAND_5GHZ_START)),
+                                           atLeast128(freq, SIX_GHZ_SCORE_START));
+        __m128i widthClasses = _mm_sub_epi32(zero, atLeast128(width, WIDE_CHANNEL_WIDTH));
+        widthClasses = _mm_add_epi32(widthClasses, whereEqual128(width, MEDIUM_CHANNEL_WIDTH, 2));
+        widthClasses = _mm_add_epi32(widthClasses, whereEqual128(width, NARROW_CHANNEL_WIDTH, 3));
+        const __m128i congested = _mm_and_si128(atLeast128(chan, CONGESTED_CHANNEL_FIRST),
+                                                _mm_cmpgt_epi32(_mm_set1_epi32(CONGESTED_CHANNEL_LAST + 1), chan));
+        __m128i chIndex = _mm_slli_epi32(_mm_add_epi32(_mm_slli_epi32(band, 2), widthClasses), 1);
+        chIndex = _mm_sub_epi32(chIndex, congested);
+        const __m128i ch = lookup128(WIDE_CHANNEL, chIndex);
+
+        const __m128i feat = lookup128(WIDE_FEATURE, _mm_or_si128(bits128(flags, FLAG_HIDDEN, 0),
+                                                                  bits128(flags, FEATURE_FLAGS, 1)));
+
+        const __m128i signal = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.signalStrength + i));
+        const __m128i rate = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.maxDataRate + i));
+        const __m128i signalClasses = _mm_sub_epi32(countMasks128(atLeast128(signal, MODERATE_SIGNAL),
+                                                                  atLeast128(signal, GOOD_SIGNAL)),
+                                                    atLeast128(signal, VERY_STRONG_SIGNAL));
+        const __m128i rateClasses = countMasks128(atLeast128(rate, FAST_RATE), atLeast128(rate, GIGABIT_RATE));
+        __m128i cfgIndex = _mm_add_epi32(times3_128(signalClasses), rateClasses);
+        cfgIndex = _mm_add_epi32(_mm_slli_epi32(cfgIndex, 1), enterprise);
+        const __m128i cfg = lookup128(WIDE_CONFIGURATION, cfgIndex);
+
+        const __m128i vendor = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.vendorScore + i));
+
+        const __m128i beacon = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.beaconInterval + i));
+        const __m128i beaconClasses = countMasks128(atLeast128(beacon, NORMAL_BEACON_START),
+                                                    _mm_cmpgt_epi32(beacon, _mm_set1_epi32(LONG_BEACON_ABOVE)));
+        const __m128i threats = bits128(flags, THREAT_FLAGS, 6);
+        const __m128i advIndex = _mm_add_epi32(times3_128(threats), beaconClasses);
+        const __m128i adv = lookup128(WIDE_ADVANCED, advIndex);
+
+        __m128i score;
+        if (weights.fixed) {
+            score = combineFixed128(enc, auth, ch, feat, cfg, vendor, adv, *weights.fixed);
+        } else {
+            const __m128i lo = combine128(enc, auth, ch, feat, cfg, vendor, adv, 0);
+            const __m128i hi = combine128(enc, auth, ch, feat, cfg, vendor, adv, 1);
+            score = _mm_unpacklo_epi64(lo, hi);
+        }
+
+        if (scores) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(scores + i), score);
+        }
+        if (grades) {
+            __m128i grade = zero;
+            for (int threshold : weights.thresholds) {
+                grade = _mm_add_epi32(grade, _mm_cmpgt_epi32(score, _mm_set1_epi32(threshold - 1)));
+            }
+            alignas(16) int32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_sub_epi32(zero, grade));
+            for (int k = 0; k < 4; ++k) {
+                grades[i + k] = static_cast<SecurityGrade>(lanes[k]);
+            }
+        }
+    }
+    return i;
+}
+
+// ---- AVX2: eight networks per iteration ----
+
+WIFI_TARGET("avx2") inline __m256i atLeast256(__m256i value, int bound) {
+    return _mm256_cmpgt_epi32(value, _mm256_set1_epi32(bound - 1));
+}
+
+WIFI_TARGET("avx2") inline __m256i countMasks256(__m256i a, __m256i b) {
+    return _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_add_epi32(a, b));
+}
+
+WIFI_TARGET("avx2") inline __m256i whereEqual256(__m256i value, int target, int result) {
+    return _mm256_and_si256(_mm256_cmpeq_epi32(value, _mm256_set1_epi32(target)), _mm256_set1_epi32(result));
+}
+
+WIFI_TARGET("avx2") inline __m256i times3_256(__m256i value) {
+    return _mm256_add_epi32(_mm256_slli_epi32(value, 1), value);
+}
+
+WIFI_TARGET("avx2") inline __m256i bits256(__m256i flags, uint32_t mask, int shift) {
+    return _mm256_srli_epi32(_mm256_and_si256(flags, _mm256_set1_epi32(static_cast<int>(mask))), shift);
+}
+
+template <size_t N>
+WIFI_TARGET("avx2") inline __m256i lookup256(const std::array<int32_t, N>& table, __m256i index) {
+    return _mm256_i32gather_epi32(table.data(), index, 4);
+}
+
+WIFI_TARGET("avx2") inline __m256i load256(const int32_t* column, size_t i) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column + i));
+}
+
+WIFI_TARGET("avx2") inline __m256d roundPositive256(__m256d x) {
+    const __m256d whole = _mm256_floor_pd(x);
+    const __m256d up = _mm256_cmp_pd(_mm256_sub_pd(x, whole), _mm256_set1_pd(0.5), _CMP_GE_OQ);
+    return _mm256_add_pd(whole, _mm256_and_pd(up, _mm256_set1_pd(1.0)));
+}
+
+WIFI_TARGET("avx2") inline __m256d toDouble256(__m256i v, int half) {
+    return _mm256_cvtepi32_pd(half ? _mm256_extracti128_si256(v, 1) : _mm256_castsi256_si128(v));
+}
+
+WIFI_TARGET("avx2") inline __m128i combine256(__m256i enc, __m256i auth, __m256i ch, __m256i feat,
+                                              __m256i cfg, __m256i vendor, __m256i adv, int half) {
+    __m256d score = _mm256_mul_pd(toDouble256(enc, half), _mm256_set1_pd(ENCRYPTION_WEIGHT));
+    score = _mm256_add_pd(score, _mm256_mul_pd(toDouble256(auth, half), _mm256_set1_pd(AUTHENTICATION_WEIGHT)));
+    score = _mm256_add_pd(score, _mm256_mul_pd(toDouble256(ch, half), _mm256_set1_pd(CHANNEL_WEIGHT)));
+    score = _mm256_add_pd(score, _mm256_mul_pd(toDouble256(feat, half), _mm256_set1_pd(FEATURE_WEIGHT)));
+    score = _mm256_add_pd(score, _mm256_mul_pd(toDouble256(cfg, half), _mm256_set1_pd(CONFIGURATION_WEIGHT)));
+    score = _mm256_add_pd(score, _mm256_mul_pd(toDouble256(vendor, half), _mm256_set1_pd(VENDOR_WEIGHT)));
+    score = _mm256_add_pd(score, _mm256_mul_pd(toDouble256(adv, half), _mm256_set1_pd(ADVANCED_WEIGHT)));
+    score = _mm256_max_pd(_mm256_setzero_pd(), _mm256_min_pd(_mm256_set1_pd(100.0), score));
+    return _mm256_cvttpd_epi32(roundPositive256(score));
+}
+
+// Same fixed-point sum as combineFixed128()
+WIFI_TARGET("avx2") inline __m256i combineFixed256(__m256i enc, __m256i auth, __m256i ch, __m256i feat,
+                                                   __m256i cfg, __m256i vendor, __m256i adv,
+                                                   const ProfileEvaluator::FixedWeights& w) {
+    __m256i total = _mm256_mullo_epi32(enc, _mm256_set1_epi32(w.encryption));
+    total = _mm256_add_epi32(total, _mm256_mullo_epi32(auth, _mm256_set1_epi32(w.authentication)));
+    total = _mm256_add_epi32(total, _mm256_mullo_epi32(ch, _mm256_set1_epi32(w.channel)));
+    total = _mm256_add_epi32(total, _mm256_mullo_epi32(feat, _mm256_set1_epi32(w.feature)));
+    total = _mm256_add_epi32(total, _mm256_mullo_epi32(cfg, _mm256_set1_epi32(w.configuration)));
+    total = _mm256_add_epi32(total, _mm256_mullo_epi32(vendor, _mm256_set1_epi32(w.vendor)));
+    total = _mm256_add_epi32(total, _mm256_mullo_epi32(adv, _mm256_set1_epi32(w.advanced)));
+    total = _mm256_max_epi32(_mm256_setzero_si256(),
+                             _mm256_min_epi32(total, _mm256_set1_epi32(100 * ProfileEvaluator::SCALE)));
+    total = _mm256_add_epi32(total, _mm256_set1_epi32(ProfileEvaluator::SCALE / 2));
+    return _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(total), _mm256_set1_ps(ProfileEvaluator::SCALE)));
+}
+
+WIFI_TARGET("avx2") size_t gradeAvx2(const NetworkBatchView& batch, int* scores, SecurityGrade* grades,
+                                     const KernelWeights& weights) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i encTable = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(WIDE_ENCRYPTION.data()));
+    static_assert(ENCRYPTION_CELLS == 8, "one encryption cell per AVX2 lane");
+
+    // Same indices as gradeSse42(), with the cells gathered
+    size_t i = 0;
+    for (; i + 8 <= batch.size; i += 8) {
+        const __m256i flags = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.flags + i));
+        const __m256i enterprise = bits256(flags, FLAG_ENTERPRISE, 1);
+
+        __m256i type = load256(batch.securityType, i);
+        type = _mm256_min_epu32(type, _mm256_set1_epi32(static_cast<int>(ENCRYPTION_CELLS - 1)));
+        const __m256i enc = _mm256_permutevar8x32_epi32(encTable, type);
+
+        const __m256i auth = lookup256(WIDE_AUTHENTICATION, _mm256_or_si256(enterprise, bits256(flags, FLAG_GUEST, 4)));
+
+        const __m256i freq = load256(batch.frequency, i);
+        const __m256i width = load256(batch.channelWidth, i);
+        const __m256i chan = load256(batch.channel, i);
+        const __m256i band = _mm256_sub_epi32(countMasks256(atLeast256(freq, BAND_2_4GHZ_START),
+                                                            atLeast256(freq, BAND_5GHZ_START)),
+                                              atLeast256(freq, SIX_GHZ_SCORE_START));
+        __m256i widthClasses = _mm256_sub_epi32(zero, atLeast256(width, WIDE_CHANNEL_WIDTH));
+        widthClasses = _mm256_add_epi32(widthClasses, whereEqual256(width, MEDIUM_CHANNEL_WIDTH, 2));
+        widthClasses = _mm256_add_epi32(widthClasses, whereEqual256(width, NARROW_CHANNEL_WIDTH, 3));
+        const __m256i lastCongested = _mm256_set1_epi32(CONGESTED_CHANNEL_LAST + 1);
+        const __m256i congested = _mm256_and_si256(atLeast256(chan, CONGESTED_CHANNEL_FIRST),
+                                                   _mm256_cmpgt_epi32(lastCongested, chan));
+        __m256i chIndex = _mm256_slli_epi32(_mm256_add_epi32(_mm256_slli_epi32(band, 2), widthClasses), 1);
+        chIndex = _mm256_sub_epi32(chIndex, congested);
+        const __m256i ch = lookup256(WIDE_CHANNEL, chIndex);
+
+        const __m256i feat = lookup256(WIDE_FEATURE, _mm256_or_si256(bits256(flags, FLAG_HIDDEN, 0),
+                                                                     bits256(flags, FEATURE_FLAGS, 1)));
+
+        const __m256i signal = load256(batch.signalStrength, i);
+        const __m256i rate = load256(batch.maxDataRate, i);
+        const __m256i signalClasses = _mm256_sub_epi32(countMasks256(atLeast256(signal, MODERATE_SIGNAL),
+                                                                     atLeast256(signal, GOOD_SIGNAL)),
+                                                       atLeast256(signal, VERY_STRONG_SIGNAL));
+        const __m256i rateClasses = countMasks256(atLeast256(rate, FAST_RATE), atLeast256(rate, GIGABIT_RATE));
+        __m256i cfgIndex = _mm256_add_epi32(times3_256(signalClasses), rateClasses);
+        cfgIndex = _mm256_add_epi32(_mm256_slli_epi32(cfgIndex, 1), enterprise);
+        const __m256i cfg = lookup256(WIDE_CONFIGURATION, cfgIndex);
+
+        const __m256i vendor = load256(batch.vendorScore, i);
+
+        const __m256i beacon = load256(batch.beaconInterval, i);
+        const __m256i beaconClasses = countMasks256(atLeast256(beacon, NORMAL_BEACON_START),
+                                                    _mm256_cmpgt_epi32(beacon, _mm256_set1_epi32(LONG_BEACON_ABOVE)));
+        const __m256i threats = bits256(flags, THREAT_FLAGS, 6);
+        const __m256i advIndex = _mm256_add_epi32(times3_256(threats), beaconClasses);
+        const __m256i adv = lookup256(WIDE_ADVANCED, advIndex);
+
+        __m256i score;
+        if (weights.fixed) {
+            score = combineFixed256(enc, auth, ch, feat, cfg, vendor, adv, *weights.fixed);
+        } else {
+            const __m128i lo = combine256(enc, auth, ch, feat, cfg, vendor, adv, 0);
+            const __m128i hi = combine256(enc, auth, ch, feat, cfg, vendor, adv, 1);
+            score = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        }
+
+        if (scores) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(scores + i), score);
+        }
+        if (grades) {
+            __m256i grade = zero;
+            for (int threshold : weights.thresholds) {
+                grade = _mm256_add_epi32(grade, _mm256_cmpgt_epi32(score, _mm256_set1_epi32(threshold - 1)));
+            }
+            alignas(32) int32_t lanes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_sub_epi32(zero, grade));
+            for (int k = 0; k < 8; ++k) {
+                grades[i + k] = static_cast<SecurityGrade>(lanes[k]);
+            }
+        }
+    }
+    return i;
+}
+
+#endif // WIFI_SCANNER_X86_SIMD
+
+} // namespace
+
+SimdLevel SecurityGrader::detectSimdLevel() {
+#ifdef WIFI_SCANNER_X86_SIMD
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("sse4.2")) return SimdLevel::SSE42;
+        return SimdLevel::SCALAR;
+    }();
+    return level;
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+std::string SecurityGrader::simdLevelToString(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SSE42: return "SSE4.2";
+        case SimdLevel::SCALAR: return "Scalar";
+        default: return "Unknown";
+    }
+}
+
+void SecurityGrader::gradeBatch(const NetworkBatchView& batch, int* scores, SecurityGrade* grades) const {
+    gradeBatch(batch, scores, grades, detectSimdLevel());
+}
+
+void SecurityGrader::gradeBatch(const NetworkBatchView& batch, int* scores, SecurityGrade* grades,
+                                SimdLevel level) const {
+    WIFI_TRACE_SCOPE(GRADE_BATCH);
+    WIFI_TRACE_COUNT(BATCH_ROWS, batch.size);
+    
+    if (static_cast<int>(level) > static_cast<int>(detectSimdLevel())) {
+        level = detectSimdLevel();
+    }
+
+    size_t done = 0;
+#ifdef WIFI_SCANNER_X86_SIMD
+    const KernelWeights weights = profile_ ? KernelWeights(*profile_) : KernelWeights();
+    if (level == SimdLevel::AVX2) {
+        done = gradeAvx2(batch, scores, grades, weights);
+    } else if (level == SimdLevel::SSE42) {
+        done = gradeSse42(batch, scores, grades, weights);
+    }
+#endif
+
+    // Scalar kernels handle the remainder rows and non-x86 targets
+    if (profile_) {
+        if (done < batch.size) {
+            profile_->gradeBatch(batch.rows(done, batch.size), scores ? scores + done : nullptr,
+                                 grades ? grades + done : nullptr);
+        }
+    } else {
+        gradeScalar(batch, done, scores, grades);
+    }
+}
+
+} // namespace WifiScanner
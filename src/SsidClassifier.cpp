@@ -0,0 +1,171 @@
+#include "SsidClassifier.h"
+#include "platforms/ScanDecoding.h"
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+
+namespace WifiScanner {
+
+namespace {
+
+unsigned char lower(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c - 'A' + 'a') : c;
+}
+
+constexpr uint32_t NO_STATE = 0xFFFFFFFF;
+
+} // namespace
+
+const SsidClassifier& SsidClassifier::instance() {
+    static const std::unique_ptr<SsidClassifier> classifier = [] {
+        std::vector<SsidRule> rules = defaultRules();
+        const char* path = std::getenv("WIFI_SCANNER_SSID_RULES");
+        if (path && *path) {
+            std::vector<SsidRule> extra = loadRules(path);
+            rules.insert(rules.end(), extra.begin(), extra.end());
+        }
+        return std::make_unique<SsidClassifier>(rules);
+    }();
+    return *classifier;
+}
+
+std::vector<SsidRule> SsidClassifier::defaultRules() {
+    std::vector<SsidRule> rules;
+    for (const char* pattern : {"guest", "visitor", "public", "hotel", "cafe", "restaurant",
+                                "airport", "mall", "library", "university", "college",
+                                "temporary", "temp", "test", "demo", "free", "open"}) {
+        rules.push_back(SsidRule{SsidCategory::GUEST, pattern});
+    }
+    return rules;
+}
+
+std::vector<SsidRule> SsidClassifier::loadRules(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error(path + ": cannot open SSID rules");
+    }
+
+    std::vector<SsidRule> rules;
+    bool inSection = false;
+    SsidCategory category = SsidCategory::GUEST;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        const std::string_view text = trim(line);
+        if (text.empty() || text.front() == '#') {
+            continue;
+        }
+        if (text.front() == '[' && text.back() == ']') {
+            const std::string_view section = text.substr(1, text.size() - 2);
+            if (section == "guest") category = SsidCategory::GUEST;
+            else if (section == "corporate") category = SsidCategory::CORPORATE;
+            else if (section == "watchlist") category = SsidCategory::WATCHLIST;
+            else if (section == "hotspot") category = SsidCategory::HOTSPOT;
+            else throw std::runtime_error(path + ":" + std::to_string(lineNumber) +
+                                          ": unknown section [" + std::string(section) + "]");
+            inSection = true;
+            continue;
+        }
+        if (!inSection) {
+            throw std::runtime_error(path + ":" + std::to_string(lineNumber) + ": pattern outside a section");
+        }
+        rules.push_back(SsidRule{category, std::string(text)});
+    }
+    return rules;
+}
+
+SsidClassifier::SsidClassifier(const std::vector<SsidRule>& rules) {
+    // Only bytes that occur in some pattern need their own column
+    for (const SsidRule& rule : rules) {
+        for (unsigned char c : rule.pattern) {
+            uint8_t& column = byteClass_[lower(c)];
+            if (column == 0) {
+                column = static_cast<uint8_t>(alphabet_++);
+            }
+        }
+    }
+    for (int c = 'A'; c <= 'Z'; ++c) {
+        byteClass_[c] = byteClass_[c - 'A' + 'a'];
+    }
+
+    // Trie
+    transitions_.assign(alphabet_, NO_STATE);
+    classOutputs_.assign(1, 0);
+    for (const SsidRule& rule : rules) {
+        if (rule.pattern.empty()) {
+            continue;
+        }
+        uint32_t state = 0;
+        for (unsigned char c : rule.pattern) {
+            uint32_t& next = transitions_[state * alphabet_ + byteClass_[c]];
+            if (next == NO_STATE) {
+                next = static_cast<uint32_t>(classOutputs_.size());
+                classOutputs_.push_back(0);
+                transitions_.resize(transitions_.size() + alphabet_, NO_STATE);
+            }
+            state = transitions_[state * alphabet_ + byteClass_[c]];
+        }
+        classOutputs_[state] |= ssidClass(rule.category);
+        ++patterns_;
+    }
+
+    // Breadth-first, so each failure target is finished before it is used:
+    // missing edges take the failure state's edge, and outputs inherit its classes
+    std::vector<uint32_t> failure(classOutputs_.size(), 0);
+    std::queue<uint32_t> pending;
+    for (size_t c = 0; c < alphabet_; ++c) {
+        uint32_t& next = transitions_[c];
+        if (next == NO_STATE) {
+            next = 0;
+        } else {
+            pending.push(next);
+        }
+    }
+    while (!pending.empty()) {
+        const uint32_t state = pending.front();
+        pending.pop();
+        classOutputs_[state] |= classOutputs_[failure[state]];
+        for (size_t c = 0; c < alphabet_; ++c) {
+            uint32_t& next = transitions_[state * alphabet_ + c];
+            const uint32_t fallback = transitions_[failure[state] * alphabet_ + c];
+            if (next == NO_STATE) {
+                next = fallback;
+            } else {
+                failure[next] = fallback;
+                pending.push(next);
+            }
+        }
+    }
+}
+
+SsidClasses SsidClassifier::classify(std::string_view ssid) const {
+    SsidClasses classes = 0;
+    uint32_t state = 0;
+    for (unsigned char c : ssid) {
+        state = transitions_[state * alphabet_ + byteClass_[c]];
+        classes |= classOutputs_[state];
+    }
+    return classes;
+}
+
+std::vector<SsidClasses> SsidClassifier::classify(const std::vector<NetworkInfo>& networks) const {
+    std::vector<SsidClasses> classes(networks.size());
+    for (size_t i = 0; i < networks.size(); ++i) {
+        classes[i] = classify(networks[i].ssid);
+    }
+    return classes;
+}
+
+std::vector<SsidClasses> SsidClassifier::classify(const NetworkTable& table) const {
+    const ColumnSpan<std::pmr::string> ssids = table.ssids();
+    std::vector<SsidClasses> classes(ssids.size());
+    for (size_t i = 0; i < ssids.size(); ++i) {
+        classes[i] = classify(ssids[i]);
+    }
+    return classes;
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,39 @@
+#include "StringPool.h"
+
+namespace WifiScanner {
+
+StringPool::StringPool(size_t capacity) : capacity_(capacity) {
+}
+
+uint16_t StringPool::intern(const std::string& value) {
+    if (value.empty()) {
+        return NONE;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(value);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+
+    if (values_.size() + 1 >= capacity_) {
+        return NONE;
+    }
+    values_.push_back(value);
+    uint16_t id = static_cast<uint16_t>(values_.size());
+    ids_.emplace(value, id);
+    return id;
+}
+
+const std::string& StringPool::lookup(uint16_t id) const {
+    static const std::string empty;
+    std::lock_guard<std::mutex> lock(mutex_);
+    return id != NONE && id <= values_.size() ? values_[id - 1] : empty;
+}
+
+size_t StringPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return values_.size();
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,295 @@
+#include "SyntheticWifiScanner.h"
+#include "NetworkTable.h"
+#include "VendorRegistry.h"
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+
+namespace WifiScanner {
+
+namespace {
+
+struct Vendor {
+    const char* oui;
+    const char* name;
+};
+
+// OUIs the platform scanners resolve, so generated BSSIDs carry consistent vendors
+const Vendor VENDORS[] = {
+    {"00:1A:11", "Google"}, {"00:1B:63", "Apple"}, {"00:1C:C0", "Cisco"}, {"00:1D:7E", "Netgear"},
+    {"00:1E:40", "Asus"},   {"00:1F:3A", "Dell"},  {"00:1F:3B", "HP"}
+};
+
+// Cumulative weights (out of 100) of SecurityType OPEN..WPA3_ENTERPRISE
+const int SECURITY_WEIGHTS[] = {10, 12, 15, 60, 72, 90, 100};
+
+const char* const HOME_NAMES[] = {"Home", "WiFi", "Net", "House", "Family", "Casa"};
+const char* const SITE_NAMES[] = {"Office", "Corp", "Campus", "Store", "Clinic", "Hotel"};
+const char* const GUEST_NAMES[] = {"Guest", "Public", "Visitor"};
+
+// 5 GHz primary channels, and the 6 GHz preferred scanning channels
+const int CHANNELS_5GHZ[] = {36, 40, 44, 48, 52, 56, 60, 64, 100, 104, 108, 112, 116, 120, 124, 128,
+                             132, 136, 140, 144, 149, 153, 157, 161, 165};
+const int CHANNELS_6GHZ[] = {5, 21, 37, 53, 69, 85, 101, 117, 133, 149, 165, 181, 197, 213, 229};
+
+// Mbps per spatial stream: HE at the top MCS for 20/40/80/160 MHz, and HT20 on 2.4 GHz
+const int HE_STREAM_RATE[] = {143, 287, 600, 1201};
+constexpr int HT20_STREAM_RATE = 72;
+
+// Chance per sweep that a BSS that dropped out is heard again
+constexpr double REAPPEAR_CHANCE = 0.25;
+
+// Sweeps within which every evil twin has appeared
+constexpr uint32_t TWIN_WINDOW = 16;
+
+int widthIndex(int width) {
+    return width >= 160 ? 3 : width >= 80 ? 2 : width >= 40 ? 1 : 0;
+}
+
+std::string capabilitiesFor(const NetworkInfo& network) {
+    std::string capabilities;
+    switch (network.securityType) {
+        case SecurityType::OPEN:
+            if (network.supportsOWE) capabilities = "[WPA2-OWE-CCMP]";
+            break;
+        case SecurityType::WEP: capabilities = "[WEP]"; break;
+        case SecurityType::WPA: capabilities = "[WPA-PSK-TKIP]"; break;
+        case SecurityType::WPA2_PERSONAL: capabilities = "[WPA2-PSK-CCMP]"; break;
+        case SecurityType::WPA2_ENTERPRISE: capabilities = "[WPA2-EAP-CCMP]"; break;
+        case SecurityType::WPA3_PERSONAL: capabilities = "[WPA2-SAE-CCMP]"; break;
+        case SecurityType::WPA3_ENTERPRISE: capabilities = "[WPA2-EAP-SUITE-B-192-GCMP-256]"; break;
+        case SecurityType::UNKNOWN: break;
+    }
+    if (network.supportsPMF) {
+        const bool required = network.securityType == SecurityType::WPA3_PERSONAL ||
+                              network.securityType == SecurityType::WPA3_ENTERPRISE;
+        capabilities += required ? "[PMF-REQUIRED]" : "[PMF]";
+    }
+    if (network.supportsWPS) capabilities += "[WPS]";
+    capabilities += "[ESS]";
+    return capabilities;
+}
+
+// The kind of near-miss a typosquatter picks: a look-alike digit, or a suffix
+std::string typoOf(const std::string& ssid) {
+    std::string typo = ssid;
+    for (char& c : typo) {
+        if (c == 'o' || c == 'O') { c = '0'; return typo; }
+        if (c == 'l' || c == 'i' || c == 'I') { c = '1'; return typo; }
+    }
+    return typo + "_";
+}
+
+} // namespace
+
+SyntheticWifiScanner::SyntheticWifiScanner(const SyntheticEnvironment& environment)
+    : environment_(environment), gen_(environment.seed) {
+    networks_.reserve(environment_.bssCount);
+    radios_.reserve(environment_.bssCount);
+    while (networks_.size() < environment_.bssCount) {
+        addEss();
+    }
+    networks_.resize(environment_.bssCount);
+    radios_.resize(environment_.bssCount);
+    evilTwinCount_ = static_cast<size_t>(std::count_if(networks_.begin(), networks_.end(), [](const NetworkInfo& network) {
+        return network.isRogueAP;
+    }));
+}
+
+std::vector<NetworkInfo> SyntheticWifiScanner::generate(size_t bssCount, uint32_t seed) {
+    SyntheticEnvironment environment;
+    environment.seed = seed;
+    environment.bssCount = bssCount;
+    return SyntheticWifiScanner(environment).networks_;
+}
+
+bool SyntheticWifiScanner::chance(double probability) {
+    return gen_() < probability * 4294967296.0;
+}
+
+void SyntheticWifiScanner::addEss() {
+    NetworkInfo ess;
+    ++essCount_;
+    const int apCount = chance(0.7) ? 1 : 2 + static_cast<int>(gen_() % std::max(environment_.maxApsPerEss - 1, 1));
+
+    const int draw = static_cast<int>(gen_() % 100);
+    ess.securityType = static_cast<SecurityType>(
+        std::upper_bound(std::begin(SECURITY_WEIGHTS), std::end(SECURITY_WEIGHTS), draw) - std::begin(SECURITY_WEIGHTS));
+    ess.isEnterprise = ess.securityType == SecurityType::WPA2_ENTERPRISE ||
+                       ess.securityType == SecurityType::WPA3_ENTERPRISE;
+    const bool wpa3 = ess.securityType == SecurityType::WPA3_PERSONAL || ess.securityType == SecurityType::WPA3_ENTERPRISE;
+    ess.supportsOWE = ess.securityType == SecurityType::OPEN && chance(0.2);
+    ess.supportsPMF = wpa3 || ess.supportsOWE || (ess.securityType == SecurityType::WPA2_PERSONAL && chance(0.3));
+    ess.supportsWPS = (ess.securityType == SecurityType::WPA2_PERSONAL || ess.securityType == SecurityType::WPA) &&
+                      chance(0.5);
+    ess.capabilities = capabilitiesFor(ess);
+
+    // Single-AP ESSes are homes; multi-AP ones are sites, some of them open guest networks
+    const unsigned number = 100 + gen_() % 9900;
+    if (apCount == 1) {
+        ess.ssid = std::string(HOME_NAMES[gen_() % std::size(HOME_NAMES)]) + "-" + std::to_string(number);
+    } else if (ess.securityType == SecurityType::OPEN && chance(0.5)) {
+        ess.ssid = std::string(GUEST_NAMES[gen_() % std::size(GUEST_NAMES)]) + "-" + std::to_string(number);
+        ess.isGuestNetwork = true;
+    } else {
+        ess.ssid = std::string(SITE_NAMES[gen_() % std::size(SITE_NAMES)]) + "-" + std::to_string(number);
+    }
+    if (chance(environment_.hiddenRate)) {
+        ess.ssid.clear();
+        ess.isHidden = true;
+    }
+
+    const Vendor& vendor = VENDORS[gen_() % std::size(VENDORS)];
+    ess.vendor = vendor.name;
+    ess.vendorId = VendorRegistry::instance().intern(ess.vendor);
+    ess.beaconInterval = chance(0.9) ? 100 : 200;
+
+    const size_t firstBss = networks_.size();
+    const int width5 = 20 << (gen_() % 4);
+    for (int ap = 0; ap < apCount; ++ap) {
+        const size_t serial = apSerial_++;
+        const int streams = 1 + static_cast<int>(gen_() % 4);
+        const int nearSignal = -35 - static_cast<int>(gen_() % 50);
+
+        // A 2.4 GHz radio on 1/6/11 (or, one time in ten, a poorly planned channel),
+        // often a 5 GHz one, and a 6 GHz one only where WPA3 or OWE allows it
+        std::vector<int> frequencies;
+        const int channel24 = chance(0.9) ? 1 + 5 * static_cast<int>(gen_() % 3) : 1 + static_cast<int>(gen_() % 13);
+        frequencies.push_back(2407 + channel24 * 5);
+        if (chance(0.6)) {
+            frequencies.push_back(5000 + CHANNELS_5GHZ[gen_() % std::size(CHANNELS_5GHZ)] * 5);
+        }
+        if ((wpa3 || ess.supportsOWE) && chance(0.3)) {
+            frequencies.push_back(5950 + CHANNELS_6GHZ[gen_() % std::size(CHANNELS_6GHZ)] * 5);
+        }
+
+        for (size_t radio = 0; radio < frequencies.size(); ++radio) {
+            NetworkInfo network = ess;
+            char bssid[18];
+            std::snprintf(bssid, sizeof(bssid), "%s:%02X:%02X:%02X", vendor.oui,
+                          static_cast<unsigned>(serial >> 12 & 0xFF), static_cast<unsigned>(serial >> 4 & 0xFF),
+                          static_cast<unsigned>((serial & 0xF) << 4 | radio));
+            network.bssid = bssid;
+            network.frequency = frequencies[radio];
+            if (network.frequency < 5000) {
+                network.channel = (network.frequency - 2407) / 5;
+                network.channelWidth = 20;
+                network.maxDataRate = HT20_STREAM_RATE * streams;
+            } else {
+                network.channel = (network.frequency - (network.frequency > 5950 ? 5950 : 5000)) / 5;
+                network.channelWidth = network.frequency > 5950 ? std::max(width5, 80) : width5;
+                network.maxDataRate = HE_STREAM_RATE[widthIndex(network.channelWidth)] * streams;
+            }
+
+            Radio state;
+            state.baseSignal = nearSignal - (network.frequency < 5000 ? 0 : network.frequency < 5950 ? 6 : 10);
+            state.visible = true;
+            network.signalStrength = state.baseSignal;
+            networks_.push_back(std::move(network));
+            radios_.push_back(state);
+        }
+    }
+
+    if (!ess.isHidden && chance(environment_.evilTwinRate)) {
+        addEvilTwin(firstBss);
+    }
+}
+
+void SyntheticWifiScanner::addEvilTwin(size_t target) {
+    NetworkInfo twin = networks_[target];
+
+    // Most twins are open copies that lure clients in; a quarter use a look-alike name
+    if (chance(0.25)) {
+        twin.ssid = typoOf(twin.ssid);
+        twin.isTypoSquatting = true;
+    } else {
+        twin.isEvilTwin = true;
+    }
+    if (chance(0.6)) {
+        twin.securityType = SecurityType::OPEN;
+        twin.isEnterprise = false;
+        twin.supportsOWE = false;
+        twin.supportsPMF = false;
+        twin.supportsWPS = false;
+    }
+    twin.capabilities = capabilitiesFor(twin);
+    twin.isRogueAP = true;
+    twin.respondsToProbes = chance(0.5);
+    twin.hasAnomalousBehavior = chance(0.3);
+    twin.beaconInterval = twin.hasAnomalousBehavior ? 50 : 100;
+    twin.isGuestNetwork = false;
+
+    // A locally administered address with no vendor behind it
+    const uint32_t high = gen_();
+    const uint32_t low = gen_();
+    char bssid[18];
+    std::snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X", (high >> 8 & 0xFC) | 0x02, high & 0xFF,
+                  low >> 24, low >> 16 & 0xFF, low >> 8 & 0xFF, low & 0xFF);
+    twin.bssid = bssid;
+    twin.vendor = "Unknown";
+    twin.vendorId = VendorRegistry::instance().intern(twin.vendor);
+
+    // Close by and loud, on the target's channel, showing up at some later sweep
+    Radio state;
+    state.baseSignal = -30 - static_cast<int>(gen_() % 25);
+    state.appearAt = 1 + gen_() % TWIN_WINDOW;
+    twin.signalStrength = state.baseSignal;
+    networks_.push_back(std::move(twin));
+    radios_.push_back(state);
+}
+
+void SyntheticWifiScanner::advance() {
+    const int step = std::max(environment_.driftDb, 1);
+    for (size_t i = 0; i < networks_.size(); ++i) {
+        Radio& radio = radios_[i];
+        if (sweeps_ < radio.appearAt) {
+            continue;
+        }
+        if (sweeps_ == radio.appearAt) {
+            radio.visible = true;
+        } else if (radio.visible ? chance(environment_.churn) : chance(REAPPEAR_CHANCE)) {
+            radio.visible = !radio.visible;
+        }
+
+        // A random walk held within a few steps of the base level
+        if (chance(environment_.driftRate)) {
+            int& signal = networks_[i].signalStrength;
+            const int delta = 1 + static_cast<int>(gen_() % step);
+            const int offset = signal - radio.baseSignal;
+            const bool down = offset >= 2 * step || (offset > -2 * step && (gen_() & 1));
+            signal = std::clamp(signal + (down ? -delta : delta), -95, -20);
+        }
+    }
+}
+
+std::vector<NetworkInfo> SyntheticWifiScanner::scan() {
+    if (sweeps_ > 0) {
+        advance();
+    }
+    ++sweeps_;
+
+    std::vector<NetworkInfo> networks;
+    networks.reserve(networks_.size());
+    for (size_t i = 0; i < networks_.size(); ++i) {
+        if (radios_[i].visible) {
+            networks.push_back(networks_[i]);
+        }
+    }
+    return networks;
+}
+
+void SyntheticWifiScanner::scanInto(NetworkTable& table, const ScanRequest& request) {
+    if (sweeps_ > 0) {
+        advance();
+    }
+    ++sweeps_;
+
+    table.reserve(table.size() + networks_.size());
+    for (size_t i = 0; i < networks_.size(); ++i) {
+        if (radios_[i].visible && request.includes(networks_[i].frequency)) {
+            table.append(networks_[i]);
+        }
+    }
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,106 @@
+#include "ThreadPool.h"
+
+namespace WifiScanner {
+
+ThreadPool::ThreadPool(size_t workerCount) {
+    workers_.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers_.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    workAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(size_t taskCount, const std::function<void(size_t)>& task) {
+    if (taskCount == 0) {
+        return;
+    }
+    if (taskCount == 1 || workers_.empty()) {
+        for (size_t i = 0; i < taskCount; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> callLock(callMutex_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        taskCount_ = taskCount;
+        nextTask_ = 0;
+        pendingTasks_ = taskCount;
+        error_ = nullptr;
+        ++generation_;
+    }
+    workAvailable_.notify_all();
+
+    // The caller works too instead of just waiting
+    runTasks();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    workDone_.wait(lock, [this] { return pendingTasks_ == 0; });
+    task_ = nullptr;
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::runTasks() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (task_ && nextTask_ < taskCount_) {
+        const size_t index = nextTask_++;
+        const std::function<void(size_t)>& task = *task_;
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+            task(index);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        lock.lock();
+        if (error && !error_) {
+            error_ = error;
+        }
+        if (--pendingTasks_ == 0) {
+            workDone_.notify_all();
+        }
+    }
+}
+
+void ThreadPool::workerLoop() {
+    size_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            workAvailable_.wait(lock, [&] { return stopping_ || generation_ != seenGeneration; });
+            if (stopping_) {
+                return;
+            }
+            seenGeneration = generation_;
+        }
+        runTasks();
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool(hardwareThreads() - 1);
+    return pool;
+}
+
+size_t ThreadPool::hardwareThreads() {
+    const unsigned count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,151 @@
+#include "Tracing.h"
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace WifiScanner {
+
+namespace Tracing {
+
+namespace {
+
+// One per thread. Only the owning thread writes, so plain load/store pairs are
+// enough; the atomics only make concurrent snapshots well-defined.
+struct Buffer {
+    std::array<std::atomic<uint64_t>, TIMER_COUNT> calls{};
+    std::array<std::atomic<uint64_t>, TIMER_COUNT> totalNanos{};
+    std::array<std::atomic<uint64_t>, TIMER_COUNT> maxNanos{};
+    std::array<std::atomic<uint64_t>, COUNTER_COUNT> counters{};
+};
+
+inline void bump(std::atomic<uint64_t>& value, uint64_t amount) {
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+void accumulate(Snapshot& totals, const Buffer& buffer) {
+    for (size_t i = 0; i < TIMER_COUNT; ++i) {
+        totals.timers[i].calls += buffer.calls[i].load(std::memory_order_relaxed);
+        totals.timers[i].totalNanos += buffer.totalNanos[i].load(std::memory_order_relaxed);
+        totals.timers[i].maxNanos = std::max(totals.timers[i].maxNanos,
+                                             buffer.maxNanos[i].load(std::memory_order_relaxed));
+    }
+    for (size_t i = 0; i < COUNTER_COUNT; ++i) {
+        totals.counters[i] += buffer.counters[i].load(std::memory_order_relaxed);
+    }
+}
+
+void zero(Buffer& buffer) {
+    for (size_t i = 0; i < TIMER_COUNT; ++i) {
+        buffer.calls[i].store(0, std::memory_order_relaxed);
+        buffer.totalNanos[i].store(0, std::memory_order_relaxed);
+        buffer.maxNanos[i].store(0, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < COUNTER_COUNT; ++i) {
+        buffer.counters[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+// Buffers of live threads plus the folded totals of threads that have exited
+struct Registry {
+    std::mutex mutex;
+    std::vector<Buffer*> live;
+    Snapshot retired;
+};
+
+Registry& registry() {
+    // Never destroyed, so thread buffers can retire during static destruction
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+struct ThreadBuffer {
+    Buffer buffer;
+    
+    ThreadBuffer() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.live.push_back(&buffer);
+    }
+    
+    ~ThreadBuffer() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        accumulate(r.retired, buffer);
+        r.live.erase(std::remove(r.live.begin(), r.live.end(), &buffer), r.live.end());
+    }
+};
+
+Buffer& threadBuffer() {
+    thread_local ThreadBuffer buffer;
+    return buffer.buffer;
+}
+
+} // namespace
+
+void setEnabled(bool enabled) {
+    detail::enabledFlag.store(enabled && compiledIn(), std::memory_order_relaxed);
+}
+
+Snapshot snapshot() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    Snapshot totals = r.retired;
+    for (const Buffer* buffer : r.live) {
+        accumulate(totals, *buffer);
+    }
+    return totals;
+}
+
+void reset() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.retired = Snapshot();
+    for (Buffer* buffer : r.live) {
+        zero(*buffer);
+    }
+}
+
+const char* timerName(Timer timer) {
+    switch (timer) {
+        case Timer::GRADE_BATCH: return "grade_batch";
+        case Timer::RANKING_KEYS: return "ranking_keys";
+        case Timer::SORT_KEYS: return "sort_keys";
+        case Timer::MERGE_RUNS: return "merge_runs";
+        case Timer::GRADE_AND_SORT: return "grade_and_sort";
+        case Timer::INCREMENTAL_UPDATE: return "incremental_update";
+        case Timer::PLATFORM_SCAN: return "platform_scan";
+        case Timer::SCORE_BREAKDOWNS: return "score_breakdowns";
+        case Timer::SCORE_PROFILES: return "score_profiles";
+        default: return "unknown";
+    }
+}
+
+const char* counterName(Counter counter) {
+    switch (counter) {
+        case Counter::NETWORKS_SCORED: return "networks_scored";
+        case Counter::BATCH_ROWS: return "batch_rows";
+        case Counter::NETWORKS_SORTED: return "networks_sorted";
+        case Counter::NETWORKS_REGRADED: return "networks_regraded";
+        case Counter::NETWORKS_REUSED: return "networks_reused";
+        case Counter::SCANS: return "scans";
+        default: return "unknown";
+    }
+}
+
+void record(Timer timer, uint64_t nanos) {
+    Buffer& buffer = threadBuffer();
+    const size_t i = static_cast<size_t>(timer);
+    bump(buffer.calls[i], 1);
+    bump(buffer.totalNanos[i], nanos);
+    if (nanos > buffer.maxNanos[i].load(std::memory_order_relaxed)) {
+        buffer.maxNanos[i].store(nanos, std::memory_order_relaxed);
+    }
+}
+
+void add(Counter counter, uint64_t amount) {
+    bump(threadBuffer().counters[static_cast<size_t>(counter)], amount);
+}
+
+} // namespace Tracing
+
+} // namespace WifiScanner
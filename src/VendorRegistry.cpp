@@ -0,0 +1,31 @@
+#include "VendorRegistry.h"
+#include "SecurityGrader.h"
+
+namespace WifiScanner {
+
+VendorRegistry& VendorRegistry::instance() {
+    static VendorRegistry registry;
+    return registry;
+}
+
+uint16_t VendorRegistry::intern(const std::string& vendor) {
+    if (vendor.empty()) {
+        return NO_VENDOR;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t known = names_.size();
+    uint16_t id = names_.intern(vendor);
+
+    // Classify once with the reference string rules, before the ID is handed out
+    if (names_.size() != known) {
+        scores_[id] = static_cast<int8_t>(SecurityGrader::vendorScore(vendor));
+    }
+    return id;
+}
+
+size_t VendorRegistry::size() const {
+    return names_.size();
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,244 @@
+#include "WeightProfile.h"
+#include "SecurityGrader.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+namespace WifiScanner {
+
+namespace {
+
+using namespace ScoringTables;
+
+int32_t toFixed(double weight) {
+    return static_cast<int32_t>(std::llround(weight * ProfileEvaluator::SCALE));
+}
+
+template <size_t N>
+std::array<int32_t, N> weighTable(const std::array<int8_t, N>& table, int32_t weight) {
+    std::array<int32_t, N> weighted{};
+    for (size_t i = 0; i < N; ++i) {
+        weighted[i] = table[i] * weight;
+    }
+    return weighted;
+}
+
+std::string trim(const std::string& text) {
+    size_t begin = 0;
+    size_t end = text.size();
+    while (begin < end && std::isspace(static_cast<unsigned char>(text[begin]))) ++begin;
+    while (end > begin && std::isspace(static_cast<unsigned char>(text[end - 1]))) --end;
+    return text.substr(begin, end - begin);
+}
+
+std::string toLower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), ::tolower);
+    return text;
+}
+
+[[noreturn]] void fail(const std::string& source, size_t line, const std::string& message) {
+    throw std::runtime_error(source + ":" + std::to_string(line) + ": " + message);
+}
+
+double parseWeight(const std::string& value, const std::string& source, size_t line) {
+    size_t used = 0;
+    double weight = 0.0;
+    try {
+        weight = std::stod(value, &used);
+    } catch (const std::exception&) {
+        used = 0;
+    }
+    if (used == 0 || used != value.size() || !std::isfinite(weight)) {
+        fail(source, line, "invalid weight '" + value + "'");
+    }
+    if (weight < 0.0 || weight > ProfileRegistry::MAX_WEIGHT) {
+        fail(source, line, "weight " + value + " is outside [0, 10]");
+    }
+    if (std::fabs(weight * ProfileEvaluator::SCALE - std::round(weight * ProfileEvaluator::SCALE)) > 1e-6) {
+        fail(source, line, "weight " + value + " has more than four decimal places");
+    }
+    return weight;
+}
+
+int parseThreshold(const std::string& value, const std::string& source, size_t line) {
+    size_t used = 0;
+    int threshold = 0;
+    try {
+        threshold = std::stoi(value, &used);
+    } catch (const std::exception&) {
+        used = 0;
+    }
+    if (used == 0 || used != value.size() || threshold < 0 || threshold > 100) {
+        fail(source, line, "invalid grade threshold '" + value + "' (expected 0-100)");
+    }
+    return threshold;
+}
+
+} // namespace
+
+ProfileEvaluator::ProfileEvaluator(const WeightProfile& profile)
+    : profile_(profile),
+      weights_{toFixed(profile.encryption), toFixed(profile.authentication), toFixed(profile.channel),
+               toFixed(profile.feature), toFixed(profile.configuration), toFixed(profile.vendor),
+               toFixed(profile.advanced)},
+      encryption_(weighTable(ENCRYPTION, weights_.encryption)),
+      authentication_(weighTable(AUTHENTICATION, weights_.authentication)),
+      channel_(weighTable(CHANNEL, weights_.channel)),
+      feature_(weighTable(FEATURE, weights_.feature)),
+      configuration_(weighTable(CONFIGURATION, weights_.configuration)),
+      advanced_(weighTable(ADVANCED, weights_.advanced)) {
+    for (int score = 0; score <= 100; ++score) {
+        if (score >= profile.excellent) grades_[score] = SecurityGrade::EXCELLENT;
+        else if (score >= profile.good) grades_[score] = SecurityGrade::GOOD;
+        else if (score >= profile.okay) grades_[score] = SecurityGrade::OKAY;
+        else if (score >= profile.bad) grades_[score] = SecurityGrade::BAD;
+        else grades_[score] = SecurityGrade::VERY_BAD;
+    }
+}
+
+int ProfileEvaluator::finish(int64_t total) const {
+    // Clamp to [0, 100] points, then round half up
+    total = std::max<int64_t>(0, std::min<int64_t>(100 * SCALE, total));
+    return static_cast<int>((total + SCALE / 2) / SCALE);
+}
+
+int ProfileEvaluator::score(const ScoreBreakdown& breakdown) const {
+    // Components are table cells, so cell * fixed weight equals the table entries above
+    int64_t total = static_cast<int64_t>(breakdown.encryption) * weights_.encryption;
+    total += static_cast<int64_t>(breakdown.authentication) * weights_.authentication;
+    total += static_cast<int64_t>(breakdown.channel) * weights_.channel;
+    total += static_cast<int64_t>(breakdown.feature) * weights_.feature;
+    total += static_cast<int64_t>(breakdown.configuration) * weights_.configuration;
+    total += static_cast<int64_t>(breakdown.vendor) * weights_.vendor;
+    total += static_cast<int64_t>(breakdown.advanced) * weights_.advanced;
+    return finish(total);
+}
+
+void ProfileEvaluator::gradeBatch(const NetworkBatchView& batch, int* scores, SecurityGrade* grades) const {
+    for (size_t i = 0; i < batch.size; ++i) {
+        const uint32_t flags = batch.flags[i];
+
+        int64_t total = encryption_[encryptionIndex(batch.securityType[i])];
+        total += authentication_[authenticationIndex(flags)];
+        total += channel_[channelIndex(batch.frequency[i], batch.channelWidth[i], batch.channel[i])];
+        total += feature_[featureIndex(flags)];
+        total += configuration_[configurationIndex(batch.signalStrength[i], batch.maxDataRate[i], flags)];
+        total += static_cast<int64_t>(batch.vendorScore[i]) * weights_.vendor;
+        total += advanced_[advancedIndex(flags, batch.beaconInterval[i])];
+
+        const int score = finish(total);
+        if (scores) scores[i] = score;
+        if (grades) grades[i] = grade(score);
+    }
+}
+
+std::vector<WeightProfile> ProfileRegistry::parse(const std::string& text, const std::string& source) {
+    std::vector<WeightProfile> profiles;
+    std::vector<size_t> sectionLines;
+    std::set<std::string> seen;
+
+    std::istringstream input(text);
+    std::string rawLine;
+    size_t lineNumber = 0;
+    while (std::getline(input, rawLine)) {
+        ++lineNumber;
+        std::string line = trim(rawLine.substr(0, rawLine.find_first_of("#;")));
+        if (line.empty()) {
+            continue;
+        }
+
+        if (line.front() == '[') {
+            if (line.back() != ']') {
+                fail(source, lineNumber, "unterminated section header");
+            }
+            std::string name = toLower(trim(line.substr(1, line.size() - 2)));
+            if (name.empty() || name.find_first_of(" \t") != std::string::npos) {
+                fail(source, lineNumber, "profile names must be a single non-empty word");
+            }
+            if (name == DEFAULT_PROFILE) {
+                fail(source, lineNumber, "the 'default' profile is built in and cannot be redefined");
+            }
+            if (!seen.insert(name).second) {
+                fail(source, lineNumber, "duplicate profile '" + name + "'");
+            }
+            profiles.emplace_back();
+            profiles.back().name = name;
+            sectionLines.push_back(lineNumber);
+            continue;
+        }
+
+        size_t equals = line.find('=');
+        if (equals == std::string::npos) {
+            fail(source, lineNumber, "expected 'key = value'");
+        }
+        if (profiles.empty()) {
+            fail(source, lineNumber, "setting outside of a [profile] section");
+        }
+        const std::string key = toLower(trim(line.substr(0, equals)));
+        const std::string value = trim(line.substr(equals + 1));
+        WeightProfile& profile = profiles.back();
+
+        if (key == "encryption") profile.encryption = parseWeight(value, source, lineNumber);
+        else if (key == "authentication") profile.authentication = parseWeight(value, source, lineNumber);
+        else if (key == "channel") profile.channel = parseWeight(value, source, lineNumber);
+        else if (key == "feature") profile.feature = parseWeight(value, source, lineNumber);
+        else if (key == "configuration") profile.configuration = parseWeight(value, source, lineNumber);
+        else if (key == "vendor") profile.vendor = parseWeight(value, source, lineNumber);
+        else if (key == "advanced") profile.advanced = parseWeight(value, source, lineNumber);
+        else if (key == "excellent") profile.excellent = parseThreshold(value, source, lineNumber);
+        else if (key == "good") profile.good = parseThreshold(value, source, lineNumber);
+        else if (key == "okay") profile.okay = parseThreshold(value, source, lineNumber);
+        else if (key == "bad") profile.bad = parseThreshold(value, source, lineNumber);
+        else fail(source, lineNumber, "unknown setting '" + key + "'");
+    }
+
+    for (size_t i = 0; i < profiles.size(); ++i) {
+        const WeightProfile& profile = profiles[i];
+        if (profile.excellent < profile.good || profile.good < profile.okay || profile.okay < profile.bad) {
+            fail(source, sectionLines[i], "profile '" + profile.name +
+                 "' needs excellent >= good >= okay >= bad");
+        }
+    }
+    return profiles;
+}
+
+size_t ProfileRegistry::loadString(const std::string& text, const std::string& source) {
+    // Compile everything before touching the registry so a bad file changes nothing
+    std::vector<std::shared_ptr<const ProfileEvaluator>> compiled;
+    for (const WeightProfile& profile : parse(text, source)) {
+        compiled.push_back(std::make_shared<const ProfileEvaluator>(profile));
+    }
+    for (auto& evaluator : compiled) {
+        profiles_[evaluator->name()] = evaluator;
+    }
+    return compiled.size();
+}
+
+size_t ProfileRegistry::loadFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("cannot open profile file '" + path + "'");
+    }
+    std::ostringstream text;
+    text << file.rdbuf();
+    return loadString(text.str(), path);
+}
+
+std::shared_ptr<const ProfileEvaluator> ProfileRegistry::find(const std::string& name) const {
+    auto it = profiles_.find(toLower(name));
+    return it == profiles_.end() ? nullptr : it->second;
+}
+
+std::vector<std::string> ProfileRegistry::names() const {
+    std::vector<std::string> result;
+    for (const auto& entry : profiles_) {
+        result.push_back(entry.first);
+    }
+    return result;
+}
+
+} // namespace WifiScanner
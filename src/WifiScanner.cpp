@@ -1,4 +1,6 @@
 #include "WifiScanner.h"
+#include "NetworkTable.h"
+#include <algorithm>
 
 #ifdef _WIN32
 #include "platforms/WindowsWifiScanner.h"
@@ -12,6 +14,18 @@
 
 namespace WifiScanner {
 
+std::vector<NetworkInfo> WifiScanner::scan(const ScanRequest& request) {
+    std::vector<NetworkInfo> networks = scan();
+    networks.erase(std::remove_if(networks.begin(), networks.end(),
+                                  [&request](const NetworkInfo& network) { return !request.includes(network.frequency); }),
+                   networks.end());
+    return networks;
+}
+
+void WifiScanner::scanInto(NetworkTable& table, const ScanRequest& request) {
+    table.append(scan(request));
+}
+
 std::unique_ptr<WifiScanner> createWifiScanner() {
 #ifdef _WIN32
     return std::make_unique<WindowsWifiScanner>();
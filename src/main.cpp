@@ -1,15 +1,53 @@
 #include "CommandProcessor.h"
+#include "OuiRegistry.h"
+#ifdef __linux__
+#include "platforms/ReplayWifiScanner.h"
+#endif
 #include <iostream>
+#include <memory>
 #include <stdexcept>
+#include <string>
 
-int main() {
+int main(int argc, char* argv[]) {
     try {
+        // --compile-oui <oui.txt | oui.csv | manuf> <database>: build a mappable vendor database
+        if (argc == 4 && std::string(argv[1]) == "--compile-oui") {
+            WifiScanner::OuiRegistry::compile(argv[2], argv[3]);
+            std::cout << "Compiled " << WifiScanner::OuiRegistry(argv[3]).size() << " OUIs into " << argv[3] << std::endl;
+            return 0;
+        }
+        
         std::cout << "Wi-Fi Scanner v1.0.0" << std::endl;
         std::cout << "Type 'help' for available commands" << std::endl;
         std::cout << "Type 'exit' to quit" << std::endl;
         std::cout << std::endl;
         
-        WifiScanner::CommandProcessor processor;
+        std::unique_ptr<WifiScanner::WifiScanner> scanner;
+#ifdef __linux__
+        // --replay <recording | manifest.replay> [--original-timing]: scan from recorded output
+        std::string replay;
+        auto timing = WifiScanner::ReplayTiming::FAST;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--replay" && i + 1 < argc) {
+                replay = argv[++i];
+            } else if (arg == "--original-timing") {
+                timing = WifiScanner::ReplayTiming::ORIGINAL;
+            } else {
+                std::cerr << "Usage: " << argv[0] << " [--replay <recording> [--original-timing]]" << std::endl;
+                return 1;
+            }
+        }
+        if (!replay.empty()) {
+            scanner = WifiScanner::ReplayWifiScanner::open(replay, timing);
+            std::cout << "Replaying " << replay << std::endl << std::endl;
+        }
+#endif
+        
+        if (!scanner) {
+            scanner = WifiScanner::createWifiScanner();
+        }
+        WifiScanner::CommandProcessor processor(std::move(scanner));
         processor.run();
         
         return 0;
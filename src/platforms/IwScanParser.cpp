@@ -0,0 +1,331 @@
+#include "platforms/IwScanParser.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <iterator>
+#include <utility>
+
+namespace WifiScanner {
+
+namespace {
+
+// Suite names as iw prints them. RSN and WPA number PSK and 802.1X the same way.
+const std::pair<std::string_view, int> AKM_SUITES[] = {
+    {"IEEE 802.1X", 1}, {"PSK", 2}, {"FT/IEEE 802.1X", 3}, {"FT/PSK", 4},
+    {"IEEE 802.1X/SHA-256", 5}, {"PSK/SHA-256", 6}, {"SAE", 8}, {"FT/SAE", 9},
+    {"IEEE 802.1X/SUITE-B", 11}, {"IEEE 802.1X/SUITE-B-192", 12}, {"FT/IEEE 802.1X/SHA-384", 13},
+    {"OWE", 18}, {"SAE-EXT-KEY", 24}, {"FT/SAE-EXT-KEY", 25}
+};
+
+const std::pair<std::string_view, int> CIPHER_SUITES[] = {
+    {"WEP-40", 1}, {"TKIP", 2}, {"CCMP", 4}, {"WEP-104", 5}, {"GCMP", 8}, {"GCMP-128", 8},
+    {"GCMP-256", 9}, {"CCMP-256", 10}
+};
+
+// The next space-separated token; "IEEE 802.1X..." counts as one
+bool nextToken(std::string_view& text, std::string_view& token) {
+    text = trimLeft(text);
+    if (text.empty()) {
+        return false;
+    }
+    size_t end = text.find(' ');
+    if (text.substr(0, end) == "IEEE" && end != std::string_view::npos) {
+        end = text.find(' ', end + 1);
+    }
+    token = text.substr(0, end);
+    text.remove_prefix(end == std::string_view::npos ? text.size() : end);
+    return true;
+}
+
+// Set the bit for a named suite, or one iw could only print as "00-0f-ac:24"
+void addSuite(std::string_view token, const std::pair<std::string_view, int>* names, size_t nameCount,
+              uint32_t& bits) {
+    for (size_t i = 0; i < nameCount; ++i) {
+        if (names[i].first == token) {
+            bits |= 1u << names[i].second;
+            return;
+        }
+    }
+    const size_t colon = token.find(':');
+    int selector = 0;
+    if (colon != std::string_view::npos && parseNumber(token.substr(colon + 1), selector) &&
+        selector >= 0 && selector < 32) {
+        bits |= 1u << selector;
+    }
+}
+
+// "5.5*" in Mb/s to 500 kb/s units
+int parseRate(std::string_view token) {
+    int megabits = 0;
+    if (!parseNumber(token, megabits)) {
+        return 0;
+    }
+    const size_t point = token.find('.');
+    const bool half = point != std::string_view::npos && point + 1 < token.size() && token[point + 1] == '5';
+    return megabits * 2 + (half ? 1 : 0);
+}
+
+// iw prints unprintable SSID bytes (and edge spaces) as \xNN
+void unescapeSsid(std::string_view text, std::string& out) {
+    out.clear();
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == '\\' && i + 3 < text.size() && text[i + 1] == 'x') {
+            unsigned value = 0;
+            const char* begin = text.data() + i + 2;
+            if (std::from_chars(begin, begin + 2, value, 16).ptr == begin + 2) {
+                out += static_cast<char>(value);
+                i += 3;
+                continue;
+            }
+        }
+        out += text[i];
+    }
+}
+
+// Highest "N streams: MCS 0-9" line of a VHT/HE RX MCS set; "not supported" lines don't count
+bool parseStreamLine(std::string_view item, int& streams) {
+    const size_t colon = item.find("streams: ");
+    if (colon == std::string_view::npos) {
+        return false;
+    }
+    int count = 0;
+    if (item.substr(colon + 9, 3) == "MCS" && parseNumber(item, count)) {
+        streams = std::max(streams, count);
+    }
+    return true;
+}
+
+} // namespace
+
+IwScanParser::IwScanParser(NetworkSink sink) : sink_(std::move(sink)) {}
+
+void IwScanParser::feedLine(std::string_view line) {
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) {
+        line.remove_suffix(1);
+    }
+
+    // Each BSS starts at column 0: "BSS 00:11:22:33:44:55(on wlan0) -- associated"
+    if (consumePrefix(line, "BSS ")) {
+        beginBss(line);
+        return;
+    }
+    if (!inBss_ || line.empty()) {
+        return;
+    }
+
+    // One tab for the BSS's own fields and element headers, more for their items
+    if (line.size() >= 2 && line[0] == '\t' && line[1] == '\t') {
+        parseBlockItem(trimLeft(line));
+    } else {
+        parseField(trimLeft(line));
+    }
+}
+
+void IwScanParser::finish() {
+    if (inBss_) {
+        emit();
+        inBss_ = false;
+    }
+}
+
+void IwScanParser::beginBss(std::string_view line) {
+    finish();
+
+    resetNetwork(network_);
+    bss_ = BssCapabilities();
+    block_ = Block::None;
+    inBss_ = true;
+    hasSsid_ = false;
+    countingStreams_ = false;
+    htWidth_ = 20;
+    vhtWidthCode_ = 0;
+    vhtSegment1_ = 0;
+    vhtSegment2_ = 0;
+    heWidth_ = 0;
+
+    // Upper case, as nl80211 reports it and the vendor lookup expects
+    for (char c : line) {
+        if (!std::isxdigit(static_cast<unsigned char>(c)) && c != ':') {
+            break;
+        }
+        network_.bssid += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+}
+
+void IwScanParser::parseField(std::string_view line) {
+    static const std::pair<std::string_view, Block> blocks[] = {
+        {"RSN:", Block::Rsn},
+        {"WPA:", Block::Wpa},
+        {"HT capabilities:", Block::HtCapabilities},
+        {"HT operation:", Block::HtOperation},
+        {"VHT capabilities:", Block::VhtCapabilities},
+        {"VHT operation:", Block::VhtOperation},
+        {"HE capabilities:", Block::HeCapabilities},
+        {"HE Operation:", Block::HeOperation},
+        {"HE operation:", Block::HeOperation}
+    };
+
+    countingStreams_ = false;
+    for (const auto& block : blocks) {
+        if (consumePrefix(line, block.first)) {
+            block_ = block.second;
+            bss_.rsn = bss_.rsn || block_ == Block::Rsn;
+            bss_.wpa = bss_.wpa || block_ == Block::Wpa;
+            // Some headers carry their first item: "RSN:\t * Version: 1"
+            line = trimLeft(line);
+            if (!line.empty()) {
+                parseBlockItem(line);
+            }
+            return;
+        }
+    }
+
+    // Any other element's items are skipped
+    block_ = Block::Other;
+    if (consumePrefix(line, "SSID:")) {
+        if (!hasSsid_) {
+            hasSsid_ = true;
+            unescapeSsid(trimLeft(line), network_.ssid);
+        }
+    } else if (consumePrefix(line, "freq: ")) {
+        parseNumber(line, network_.frequency);
+    } else if (consumePrefix(line, "signal: ")) {
+        parseNumber(line, network_.signalStrength);
+    } else if (consumePrefix(line, "beacon interval: ")) {
+        parseNumber(line, network_.beaconInterval);
+    } else if (consumePrefix(line, "capability: ")) {
+        // "ESS Privacy ShortSlotTime (0x0411)"
+        const size_t hex = line.rfind("(0x");
+        if (hex != std::string_view::npos) {
+            const char* begin = line.data() + hex + 3;
+            std::from_chars(begin, line.data() + line.size(), bss_.capability, 16);
+        }
+    } else if (consumePrefix(line, "Supported rates: ") || consumePrefix(line, "Extended supported rates: ")) {
+        std::string_view token;
+        while (nextToken(line, token)) {
+            bss_.legacyRate = std::max(bss_.legacyRate, parseRate(token));
+        }
+    } else if (consumePrefix(line, "WPS:")) {
+        bss_.wps = true;
+    }
+}
+
+void IwScanParser::parseBlockItem(std::string_view item) {
+    consumePrefix(item, "* ");
+
+    switch (block_) {
+        case Block::Rsn:
+            if (consumePrefix(item, "Capabilities: ")) {
+                bss_.mfpRequired = item.find("MFP-required") != std::string_view::npos;
+                bss_.mfpCapable = item.find("MFP-capable") != std::string_view::npos;
+            } else {
+                parseSecurityItem(item, bss_.rsnAkms, bss_.rsnCiphers);
+            }
+            break;
+        case Block::Wpa:
+            parseSecurityItem(item, bss_.wpaAkms, bss_.wpaCiphers);
+            break;
+        case Block::HtCapabilities: {
+            // "HT RX MCS rate indexes supported: 0-15, 32", or "HT TX/RX ..." when both match
+            const size_t label = item.find("RX MCS rate indexes supported: ");
+            if (label == std::string_view::npos) {
+                break;
+            }
+            item.remove_prefix(label + 31);
+            int highest = -1;
+            std::string_view range;
+            while (nextToken(item, range)) {
+                const size_t dash = range.find('-');
+                int end = 0;
+                if (parseNumber(dash == std::string_view::npos ? range : range.substr(dash + 1), end) && end < 32) {
+                    highest = std::max(highest, end);  // MCS 32 is a 40 MHz duplicate, not a stream
+                }
+            }
+            if (highest >= 0) {
+                bss_.htStreams = highest / 8 + 1;
+            }
+            break;
+        }
+        case Block::HtOperation:
+            if (consumePrefix(item, "STA channel width: ")) {
+                htWidth_ = item.substr(0, 3) == "any" ? 40 : 20;
+            }
+            break;
+        case Block::VhtCapabilities:
+            if (item.substr(0, 15) == "VHT RX MCS set:") {
+                countingStreams_ = true;
+            } else if (!countingStreams_ || !parseStreamLine(item, bss_.vhtStreams)) {
+                countingStreams_ = false;
+            }
+            break;
+        case Block::VhtOperation:
+            if (consumePrefix(item, "channel width: ")) {
+                parseNumber(item, vhtWidthCode_);
+            } else if (consumePrefix(item, "center freq segment 1: ")) {
+                parseNumber(item, vhtSegment1_);
+            } else if (consumePrefix(item, "center freq segment 2: ")) {
+                parseNumber(item, vhtSegment2_);
+            }
+            break;
+        case Block::HeCapabilities:
+            if (item.substr(0, 31) == "HE RX MCS and NSS set <= 80 MHz") {
+                countingStreams_ = true;
+            } else if (!countingStreams_ || !parseStreamLine(item, bss_.heStreams)) {
+                countingStreams_ = false;
+            }
+            break;
+        case Block::HeOperation:
+            // 6 GHz operation information: "Channel Width: 2" or "Channel Width: 80 MHz"
+            if (consumePrefix(item, "Channel Width: ")) {
+                int width = 0;
+                if (parseNumber(item, width)) {
+                    heWidth_ = width <= 3 ? 20 << width : width;
+                }
+            }
+            break;
+        case Block::None:
+        case Block::Other:
+            break;
+    }
+}
+
+void IwScanParser::parseSecurityItem(std::string_view item, uint32_t& akms, uint32_t& ciphers) {
+    const bool isAkm = consumePrefix(item, "Authentication suites: ");
+    if (!isAkm && !consumePrefix(item, "Group cipher: ") && !consumePrefix(item, "Pairwise ciphers: ")) {
+        return;
+    }
+    std::string_view token;
+    while (nextToken(item, token)) {
+        if (isAkm) {
+            addSuite(token, AKM_SUITES, std::size(AKM_SUITES), akms);
+        } else {
+            addSuite(token, CIPHER_SUITES, std::size(CIPHER_SUITES), ciphers);
+        }
+    }
+}
+
+void IwScanParser::emit() {
+    network_.isHidden = network_.ssid.empty() ||
+                        std::all_of(network_.ssid.begin(), network_.ssid.end(), [](char c) { return c == '\0'; });
+    if (network_.isHidden) {
+        network_.ssid.clear();
+    }
+    network_.channel = channelForFrequency(network_.frequency);
+
+    // Same rules as the VHT operation element: 80 MHz with a second segment 8 away is 160
+    int vhtWidth = 0;
+    const int gap = std::abs(vhtSegment2_ - vhtSegment1_);
+    if (vhtWidthCode_ == 1) {
+        vhtWidth = (vhtSegment2_ != 0 && (gap == 8 || gap > 16)) ? 160 : 80;
+    } else if (vhtWidthCode_ == 2 || vhtWidthCode_ == 3) {
+        vhtWidth = 160;
+    }
+    bss_.width = std::max({htWidth_, vhtWidth, heWidth_});
+    applyBssCapabilities(bss_, network_);
+
+    sink_(network_);
+    ++count_;
+}
+
+} // namespace WifiScanner
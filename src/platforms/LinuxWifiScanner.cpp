@@ -1,8 +1,19 @@
 #include "platforms/LinuxWifiScanner.h"
+#include "platforms/IwScanParser.h"
+#include "platforms/Nl80211.h"
+#include "platforms/ScanDecoding.h"
+#include "NetworkTable.h"
+#include "ThreadPool.h"
+#include "OuiRegistry.h"
+#include "SsidClassifier.h"
+#include "VendorRegistry.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
-#include <regex>
+#include <array>
+#include <cctype>
+#include <string_view>
+#include <unordered_map>
 #include <cstdlib>
 #include <cstring>
 #include <unistd.h>
@@ -12,8 +23,26 @@
 
 namespace WifiScanner {
 
-LinuxWifiScanner::LinuxWifiScanner() {
-    // Constructor - check for required tools
+namespace {
+
+// Copy an nmcli -t field, removing the backslash escapes
+void unescapeField(std::string_view field, std::string& out) {
+    out.clear();
+    for (size_t i = 0; i < field.size(); ++i) {
+        if (field[i] == '\\' && i + 1 < field.size()) {
+            ++i;
+        }
+        out += field[i];
+    }
+}
+
+} // namespace
+
+LinuxWifiScanner::LinuxWifiScanner() : backends_(ScanBackendRegistry::instance()) {
+    // Backends are probed on first use, not here
+}
+
+LinuxWifiScanner::LinuxWifiScanner(ScanBackendRegistry& backends) : backends_(backends) {
 }
 
 LinuxWifiScanner::~LinuxWifiScanner() {
@@ -21,29 +50,58 @@ LinuxWifiScanner::~LinuxWifiScanner() {
 }
 
 std::vector<NetworkInfo> LinuxWifiScanner::scan() {
+    return scan(ScanRequest::full());
+}
+
+std::vector<NetworkInfo> LinuxWifiScanner::scan(const ScanRequest& request) {
     std::vector<NetworkInfo> networks;
+    scanWith(request, [&networks](const NetworkInfo& network) { networks.push_back(network); });
+    return networks;
+}
+
+void LinuxWifiScanner::scanInto(NetworkTable& table, const ScanRequest& request) {
+    scanWith(request, [&table](const NetworkInfo& network) { table.append(network); });
+}
+
+size_t LinuxWifiScanner::scanWith(const ScanRequest& request, const NetworkSink& sink) const {
+    // Cached tables and nmcli cover every channel; keep only the requested ones
+    size_t count = 0;
+    const NetworkSink filtered = [&request, &sink, &count](const NetworkInfo& network) {
+        if (request.includes(network.frequency)) {
+            sink(network);
+            ++count;
+        }
+    };
     
-    // Try NetworkManager first (more reliable)
-    networks = scanUsingNetworkManager();
-    
-    // If NetworkManager fails, fall back to iw command
-    if (networks.empty()) {
-        networks = scanUsingIw();
-    }
-    
-    // If both fail, try scanning /proc/net/wireless
-    if (networks.empty()) {
-        networks = scanUsingProcNet();
+    // The registry probed the system once. A probed backend can still fail at
+    // scan time (no permission to trigger, a tool erroring out), so fall back in
+    // order of preference until one reports networks. A backend that fails emits
+    // nothing, so nothing is reported twice.
+    for (ScanBackend backend : backends_.available()) {
+        size_t found = 0;
+        switch (backend) {
+            case ScanBackend::NL80211:
+                found = scanUsingNl80211(request, filtered);
+                break;
+            case ScanBackend::NETWORK_MANAGER:
+                found = scanUsingNetworkManager(request, filtered);
+                break;
+            case ScanBackend::IW:
+                found = scanUsingIw(request, filtered);
+                break;
+            case ScanBackend::PROC_NET:
+                found = scanUsingProcNet(filtered);
+                break;
+        }
+        if (found > 0) {
+            break;
+        }
     }
-    
-    return networks;
+    return count;
 }
 
 bool LinuxWifiScanner::isSupported() const {
-    // Check if we have any of the required tools
-    return (system("which nmcli >/dev/null 2>&1") == 0) ||
-           (system("which iw >/dev/null 2>&1") == 0) ||
-           (system("which iwlist >/dev/null 2>&1") == 0);
+    return backends_.best().has_value();
 }
 
 std::string LinuxWifiScanner::getPlatformName() const {
@@ -80,165 +138,223 @@ int LinuxWifiScanner::parseSignalStrength(int rssi) const {
 }
 
 int LinuxWifiScanner::frequencyToChannel(int frequency) const {
-    if (frequency >= 2412 && frequency <= 2484) {
-        return (frequency - 2412) / 5 + 1;
-    } else if (frequency >= 5170 && frequency <= 5825) {
-        return (frequency - 5170) / 5 + 34;
-    }
-    return 0;
+    return channelForFrequency(frequency);
 }
 
-int LinuxWifiScanner::frequencyToChannel(int frequency) const {
-    if (frequency >= 2412 && frequency <= 2484) {
-        return (frequency - 2412) / 5 + 1;
-    } else if (frequency >= 5170 && frequency <= 5825) {
-        return (frequency - 5170) / 5 + 34;
+int LinuxWifiScanner::channelToFrequency(int channel) const {
+    if (channel >= 1 && channel <= 13) {
+        return 2412 + (channel - 1) * 5;
+    } else if (channel == 14) {
+        return 2484;
+    } else if (channel >= 34 && channel <= 177) {
+        return 5170 + (channel - 34) * 5;
     }
     return 0;
 }
 
-std::vector<NetworkInfo> LinuxWifiScanner::scanUsingIw() const {
-    std::vector<NetworkInfo> networks;
-    
-    // Use 'iw dev' to get interface names
-    std::string cmd = "iw dev | grep Interface | awk '{print $2}'";
-    FILE* pipe = popen(cmd.c_str(), "r");
-    if (!pipe) return networks;
-    
-    char buffer[128];
-    std::string result;
-    while (fgets(buffer, sizeof(buffer), pipe) != NULL) {
-        result += buffer;
-    }
-    pclose(pipe);
-    
-    // Parse interfaces and scan each one
-    std::istringstream iss(result);
-    std::string interface;
-    while (std::getline(iss, interface)) {
-        // Remove newline
-        interface.erase(std::remove(interface.begin(), interface.end(), '\n'), interface.end());
-        if (interface.empty()) continue;
+size_t LinuxWifiScanner::scanUsingNl80211(const ScanRequest& request, const NetworkSink& sink) const {
+    // Everything is collected before the sink sees it, so a failure part way
+    // through reports nothing and the caller can fall back to another backend
+    std::vector<std::vector<NetworkInfo>> perRadio;
+    try {
+        const std::vector<Nl80211Socket::Interface> interfaces = Nl80211Socket().interfaces();
+        perRadio.resize(interfaces.size());
         
-        // Scan this interface
-        auto interfaceNetworks = scanInterfaceWithIw(interface);
-        networks.insert(networks.end(), interfaceNetworks.begin(), interfaceNetworks.end());
+        // One socket per radio, so no thread waits on another's dump
+        forEachRadio(interfaces.size(), [&](size_t i) {
+            Nl80211Socket socket;
+            // Triggering needs CAP_NET_ADMIN. Without it the kernel's cached results
+            // are stale, so an active scan skips the radio rather than report them.
+            if (request.mode == ScanMode::ACTIVE && !socket.triggerScan(interfaces[i].index, request.frequencies)) {
+                return;
+            }
+            socket.dumpScanResults(interfaces[i].index, [this, &perRadio, &interfaces, i](NetworkInfo& network) {
+                completeNetwork(network);
+                perRadio[i].push_back(network);
+                perRadio[i].back().radios = interfaces[i].name;
+            });
+        });
+    } catch (const std::runtime_error&) {
+        return 0;
     }
     
-    return networks;
+    std::vector<NetworkInfo> merged = mergeRadioScans(perRadio);
+    for (const auto& network : merged) {
+        sink(network);
+    }
+    return merged.size();
 }
 
-std::vector<NetworkInfo> LinuxWifiScanner::scanInterfaceWithIw(const std::string& interface) const {
+std::vector<NetworkInfo> LinuxWifiScanner::parseNl80211Dump(const std::string& capture) const {
     std::vector<NetworkInfo> networks;
-    
-    // Use 'iw dev <interface> scan' to get networks
-    std::string cmd = "iw dev " + interface + " scan | grep -E 'SSID|BSS|freq|signal|capabilities'";
-    FILE* pipe = popen(cmd.c_str(), "r");
-    if (!pipe) return networks;
-    
-    char buffer[512];
-    std::string result;
-    while (fgets(buffer, sizeof(buffer), pipe) != NULL) {
-        result += buffer;
+    parseNl80211Dump(capture, [&networks](const NetworkInfo& network) { networks.push_back(network); });
+    return networks;
+}
+
+size_t LinuxWifiScanner::parseNl80211Dump(const std::string& capture, const NetworkSink& sink) const {
+    Nl80211ScanDecoder decoder([this, &sink](NetworkInfo& network) {
+        completeNetwork(network);
+        sink(network);
+    });
+    decoder.feed(capture.data(), capture.size());
+    return decoder.count();
+}
+
+void LinuxWifiScanner::completeNetwork(NetworkInfo& network) const {
+    network.isGuestNetwork = detectGuestNetwork(network.ssid);
+    network.vendor = extractVendorFromBSSID(network.bssid);
+    network.vendorId = VendorRegistry::instance().intern(network.vendor);
+}
+
+size_t LinuxWifiScanner::scanUsingIw(const ScanRequest& request, const NetworkSink& sink) const {
+    const std::vector<std::string> interfaces = listIwInterfaces();
+    if (interfaces.empty()) return 0;
+    
+    std::vector<std::vector<NetworkInfo>> perRadio(interfaces.size());
+    forEachRadio(interfaces.size(), [&](size_t i) {
+        scanInterfaceWithIw(interfaces[i], request, [&perRadio, &interfaces, i](const NetworkInfo& network) {
+            perRadio[i].push_back(network);
+            perRadio[i].back().radios = interfaces[i];
+        });
+    });
+    
+    std::vector<NetworkInfo> merged = mergeRadioScans(perRadio);
+    for (const auto& network : merged) {
+        sink(network);
     }
+    return merged.size();
+}
+
+std::vector<std::string> LinuxWifiScanner::listIwInterfaces() const {
+    std::vector<std::string> interfaces;
+    
+    // 'iw dev' lists one "Interface <name>" line per wireless interface
+    FILE* pipe = popen("iw dev 2>/dev/null", "r");
+    if (!pipe) return interfaces;
+    
+    char* buffer = nullptr;
+    size_t capacity = 0;
+    ssize_t length;
+    while ((length = getline(&buffer, &capacity, pipe)) > 0) {
+        std::string_view line = trimLeft(std::string_view(buffer, static_cast<size_t>(length)));
+        if (consumePrefix(line, "Interface ")) {
+            while (!line.empty() && std::isspace(static_cast<unsigned char>(line.back()))) {
+                line.remove_suffix(1);
+            }
+            interfaces.emplace_back(line);
+        }
+    }
+    free(buffer);
     pclose(pipe);
     
-    // Parse the scan results
-    networks = parseIwScanOutput(result);
-    
-    return networks;
+    return interfaces;
 }
 
-std::vector<NetworkInfo> LinuxWifiScanner::parseIwScanOutput(const std::string& output) const {
-    std::vector<NetworkInfo> networks;
-    std::istringstream iss(output);
-    std::string line;
-    
-    NetworkInfo current;
-    bool hasBSS = false;
-    
-    while (std::getline(iss, line)) {
-        if (line.find("BSS ") != std::string::npos) {
-            // Save previous network if we have one
-            if (hasBSS && !current.ssid.empty()) {
-                // Fill in missing fields
-                if (current.frequency > 0) {
-                    current.channel = frequencyToChannel(current.frequency);
+void LinuxWifiScanner::forEachRadio(size_t radioCount, const std::function<void(size_t)>& task) const {
+    if (radioCount == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(radioPoolMutex_);
+    // The calling thread takes a radio too
+    if (!radioPool_ || radioPool_->workerCount() + 1 < radioCount) {
+        radioPool_ = std::make_unique<ThreadPool>(radioCount - 1);
+    }
+    radioPool_->parallelFor(radioCount, task);
+}
+
+std::vector<NetworkInfo> LinuxWifiScanner::mergeRadioScans(std::vector<std::vector<NetworkInfo>>& perRadio) {
+    std::vector<NetworkInfo> merged;
+    std::unordered_map<std::string, size_t> byBssid;
+    for (auto& observations : perRadio) {
+        for (auto& network : observations) {
+            auto found = network.bssid.empty() ? byBssid.end() : byBssid.find(network.bssid);
+            if (found == byBssid.end()) {
+                if (!network.bssid.empty()) {
+                    byBssid.emplace(network.bssid, merged.size());
                 }
-                current.isGuestNetwork = detectGuestNetwork(current.ssid);
-                current.vendor = extractVendorFromBSSID(current.bssid);
-                current.channelWidth = estimateChannelWidth(current.frequency);
-                current.supportsPMF = checkForPMF(current.capabilities);
-                current.supportsOWE = checkForOWE(current.capabilities);
-                current.supportsWPS = checkForWPS(current.capabilities);
-                current.maxDataRate = estimateDataRate(current.frequency, current.channelWidth);
-                
-                networks.push_back(current);
+                merged.push_back(std::move(network));
+                continue;
             }
             
-            // Start new network
-            current = NetworkInfo();
-            hasBSS = true;
-            
-            // Parse BSSID
-            std::regex bssRegex(R"(BSS ([0-9a-fA-F:]+))");
-            std::smatch match;
-            if (std::regex_search(line, match, bssRegex)) {
-                current.bssid = match[1].str();
-            }
-        } else if (line.find("SSID: ") != std::string::npos) {
-            std::regex ssidRegex(R"(SSID: (.+))");
-            std::smatch match;
-            if (std::regex_search(line, match, ssidRegex)) {
-                current.ssid = match[1].str();
-            }
-        } else if (line.find("freq: ") != std::string::npos) {
-            std::regex freqRegex(R"(freq: (\d+))");
-            std::smatch match;
-            if (std::regex_search(line, match, freqRegex)) {
-                current.frequency = std::stoi(match[1].str());
+            NetworkInfo& kept = merged[found->second];
+            std::string radios = std::move(kept.radios);
+            if (!network.radios.empty()) {
+                radios += radios.empty() ? "" : ",";
+                radios += network.radios;
             }
-        } else if (line.find("signal: ") != std::string::npos) {
-            std::regex signalRegex(R"(signal: (-\d+))");
-            std::smatch match;
-            if (std::regex_search(line, match, signalRegex)) {
-                current.signalStrength = std::stoi(match[1].str());
-            }
-        } else if (line.find("capabilities: ") != std::string::npos) {
-            std::regex capRegex(R"(capabilities: (.+))");
-            std::smatch match;
-            if (std::regex_search(line, match, capRegex)) {
-                current.capabilities = match[1].str();
+            if (network.signalStrength > kept.signalStrength) {
+                kept = std::move(network);
             }
+            kept.radios = std::move(radios);
         }
     }
-    
-    // Don't forget the last network
-    if (hasBSS && !current.ssid.empty()) {
-        if (current.frequency > 0) {
-            current.channel = frequencyToChannel(current.frequency);
+    return merged;
+}
+
+size_t LinuxWifiScanner::scanInterfaceWithIw(const std::string& interface, const ScanRequest& request,
+                                             const NetworkSink& sink) const {
+    
+    // 'scan dump' prints the kernel's table without scanning; 'scan freq ...' sweeps only those channels
+    std::string cmd = "iw dev " + interface + " scan";
+    if (request.mode == ScanMode::CACHED) {
+        cmd += " dump";
+    } else if (request.isTargeted()) {
+        cmd += " freq";
+        for (int frequency : request.frequencies) {
+            cmd += " " + std::to_string(frequency);
         }
-        current.isGuestNetwork = detectGuestNetwork(current.ssid);
-        current.vendor = extractVendorFromBSSID(current.bssid);
-        current.channelWidth = estimateChannelWidth(current.frequency);
-        current.supportsPMF = checkForPMF(current.capabilities);
-        current.supportsOWE = checkForOWE(current.capabilities);
-        current.supportsWPS = checkForWPS(current.capabilities);
-        current.maxDataRate = estimateDataRate(current.frequency, current.channelWidth);
-        
-        networks.push_back(current);
     }
+    cmd += " 2>/dev/null";
     
-    return networks;
+    // The full output is parsed line by line as it arrives; nothing is filtered out first
+    FILE* pipe = popen(cmd.c_str(), "r");
+    if (!pipe) return 0;
+    
+    IwScanParser parser([this, &sink](NetworkInfo& network) {
+        completeNetwork(network);
+        sink(network);
+    });
+    char* buffer = nullptr;
+    size_t capacity = 0;
+    ssize_t length;
+    while ((length = getline(&buffer, &capacity, pipe)) > 0) {
+        parser.feedLine(std::string_view(buffer, static_cast<size_t>(length)));
+    }
+    free(buffer);
+    pclose(pipe);
+    
+    parser.finish();
+    return parser.count();
 }
 
-std::vector<NetworkInfo> LinuxWifiScanner::scanUsingNetworkManager() const {
+std::vector<NetworkInfo> LinuxWifiScanner::parseIwScanOutput(const std::string& output) const {
     std::vector<NetworkInfo> networks;
-    
-    // Use 'nmcli device wifi list' to get networks
-    std::string cmd = "nmcli -t -f SSID,BSSID,CHAN,RATE,SIGNAL,SECURITY device wifi list";
+    parseIwScanOutput(output, [&networks](const NetworkInfo& network) { networks.push_back(network); });
+    return networks;
+}
+
+size_t LinuxWifiScanner::parseIwScanOutput(const std::string& output, const NetworkSink& sink) const {
+    IwScanParser parser([this, &sink](NetworkInfo& network) {
+        completeNetwork(network);
+        sink(network);
+    });
+    const std::string_view text(output);
+    size_t position = 0;
+    std::string_view line;
+    while (nextLine(text, position, line)) {
+        parser.feedLine(line);
+    }
+    parser.finish();
+    return parser.count();
+}
+
+size_t LinuxWifiScanner::scanUsingNetworkManager(const ScanRequest& request, const NetworkSink& sink) const {
+
+    // Use 'nmcli device wifi list' to get networks; NetworkManager cannot sweep only some channels
+    std::string cmd = "nmcli -t -f SSID,BSSID,CHAN,FREQ,RATE,SIGNAL,SECURITY device wifi list --rescan ";
+    cmd += request.mode == ScanMode::CACHED ? "no" : "yes";
     FILE* pipe = popen(cmd.c_str(), "r");
-    if (!pipe) return networks;
+    if (!pipe) return 0;
     
     char buffer[512];
     std::string result;
@@ -248,76 +364,86 @@ std::vector<NetworkInfo> LinuxWifiScanner::scanUsingNetworkManager() const {
     pclose(pipe);
     
     // Parse NetworkManager output
-    networks = parseNmcliOutput(result);
-    
-    return networks;
+    return parseNmcliOutput(result, sink);
 }
 
 std::vector<NetworkInfo> LinuxWifiScanner::parseNmcliOutput(const std::string& output) const {
     std::vector<NetworkInfo> networks;
-    std::istringstream iss(output);
-    std::string line;
-    
-    while (std::getline(iss, line)) {
+    parseNmcliOutput(output, [&networks](const NetworkInfo& network) { networks.push_back(network); });
+    return networks;
+}
+
+size_t LinuxWifiScanner::parseNmcliOutput(const std::string& output, const NetworkSink& sink) const {
+    size_t count = 0;
+    const std::string_view text(output);
+    size_t position = 0;
+    std::string_view line;
+    NetworkInfo info;
+    std::string security;
+    
+    while (nextLine(text, position, line)) {
         if (line.empty()) continue;
         
-        NetworkInfo info;
-        std::vector<std::string> fields;
-        std::stringstream ss(line);
-        std::string field;
-        
-        // Split by colon (nmcli uses colon as separator)
-        while (std::getline(ss, field, ':')) {
-            fields.push_back(field);
+        // nmcli -t separates fields with ':' and escapes literal colons (as in BSSIDs) as "\:"
+        std::array<std::string_view, 7> fields;
+        size_t fieldCount = 0;
+        size_t fieldStart = 0;
+        for (size_t i = 0; i <= line.size() && fieldCount < fields.size(); ++i) {
+            if (i < line.size() && line[i] == '\\') {
+                ++i;
+            } else if (i == line.size() || line[i] == ':') {
+                fields[fieldCount++] = line.substr(fieldStart, i - fieldStart);
+                fieldStart = i + 1;
+            }
         }
         
-        if (fields.size() >= 6) {
-            info.ssid = fields[0];
-            info.bssid = fields[1];
+        // Lines without FREQ come from older recordings; their channel numbers
+        // are taken as 2.4 or 5 GHz, since 6 GHz reuses the same numbers
+        const bool hasFrequency = fieldCount == fields.size();
+        if (hasFrequency || fieldCount == fields.size() - 1) {
+            const size_t rest = hasFrequency ? 4 : 3;
+            resetNetwork(info);
+            unescapeField(fields[0], info.ssid);
+            unescapeField(fields[1], info.bssid);
             
-            if (!fields[2].empty()) {
-                info.channel = std::stoi(fields[2]);
+            // Frequency, e.g. "5955 MHz"; the channel alone is ambiguous across bands
+            parseNumber(fields[2], info.channel);
+            if (!hasFrequency || !parseNumber(fields[3], info.frequency)) {
                 info.frequency = channelToFrequency(info.channel);
             }
             
-            if (!fields[3].empty()) {
-                // Parse rate (e.g., "54 Mbit/s")
-                std::regex rateRegex(R"((\d+))");
-                std::smatch match;
-                if (std::regex_search(fields[3], match, rateRegex)) {
-                    info.maxDataRate = std::stoi(match[1].str());
-                }
-            }
+            // Rate, e.g. "54 Mbit/s"
+            parseNumber(fields[rest], info.maxDataRate);
+            parseNumber(fields[rest + 1], info.signalStrength);
             
-            if (!fields[4].empty()) {
-                info.signalStrength = std::stoi(fields[4]);
-            }
-            
-            info.securityType = parseSecurityType(fields[5]);
+            unescapeField(fields[rest + 2], security);
+            info.securityType = parseSecurityType(security);
             info.isEnterprise = (info.securityType == SecurityType::WPA2_ENTERPRISE || 
                                info.securityType == SecurityType::WPA3_ENTERPRISE);
             
             // Fill in additional fields
             info.isGuestNetwork = detectGuestNetwork(info.ssid);
             info.vendor = extractVendorFromBSSID(info.bssid);
+            info.vendorId = VendorRegistry::instance().intern(info.vendor);
             info.channelWidth = estimateChannelWidth(info.frequency);
             info.supportsPMF = checkForPMF(info.capabilities);
             info.supportsOWE = checkForOWE(info.capabilities);
             info.supportsWPS = checkForWPS(info.capabilities);
             
-            networks.push_back(info);
+            sink(info);
+            ++count;
         }
     }
     
-    return networks;
+    return count;
 }
 
-std::vector<NetworkInfo> LinuxWifiScanner::scanUsingProcNet() const {
-    std::vector<NetworkInfo> networks;
+size_t LinuxWifiScanner::scanUsingProcNet(const NetworkSink& sink) const {
+    size_t count = 0;
     
     // Read /proc/net/wireless for basic information
     std::ifstream file("/proc/net/wireless");
-    if (!file.is_open()) return networks;
+    if (!file.is_open()) return count;
     
     std::string line;
     // Skip header lines
@@ -342,56 +468,23 @@ std::vector<NetworkInfo> LinuxWifiScanner::scanUsingProcNet() const {
             // Try to get SSID from interface name or other sources
             info.ssid = "Unknown_" + interface;
             
-            networks.push_back(info);
+            sink(info);
+            ++count;
         }
     }
     
-    return networks;
+    return count;
 }
 
 bool LinuxWifiScanner::detectGuestNetwork(const std::string& ssid) const {
-    std::string lowerSSID = ssid;
-    std::transform(lowerSSID.begin(), lowerSSID.end(), lowerSSID.begin(), ::tolower);
-    
-    std::vector<std::string> guestPatterns = {
-        "guest", "visitor", "public", "hotel", "cafe", "restaurant",
-        "airport", "mall", "library", "university", "college",
-        "temporary", "temp", "test", "demo", "free", "open"
-    };
-    
-    for (const auto& pattern : guestPatterns) {
-        if (lowerSSID.find(pattern) != std::string::npos) {
-            return true;
-        }
-    }
-    
-    return false;
+    return SsidClassifier::instance().matches(ssid, SsidCategory::GUEST);
 }
 
 std::string LinuxWifiScanner::extractVendorFromBSSID(const std::string& bssid) const {
     if (bssid.length() < 17) return "";
     
-    // Extract OUI (first 6 characters)
-    std::string oui = bssid.substr(0, 8);
-    
-    // Common vendor OUIs
-    if (oui.substr(0, 8) == "00:1A:11" || oui.substr(0, 8) == "00:1A:11") {
-        return "Google";
-    } else if (oui.substr(0, 8) == "00:1B:63" || oui.substr(0, 8) == "00:1B:63") {
-        return "Apple";
-    } else if (oui.substr(0, 8) == "00:1C:C0" || oui.substr(0, 8) == "00:1C:C0") {
-        return "Cisco";
-    } else if (oui.substr(0, 8) == "00:1D:7E" || oui.substr(0, 8) == "00:1D:7E") {
-        return "Netgear";
-    } else if (oui.substr(0, 8) == "00:1E:40" || oui.substr(0, 8) == "00:1E:40") {
-        return "Asus";
-    } else if (oui.substr(0, 8) == "00:1F:3A" || oui.substr(0, 8) == "00:1F:3A") {
-        return "Dell";
-    } else if (oui.substr(0, 8) == "00:1F:3B" || oui.substr(0, 8) == "00:1F:3B") {
-        return "HP";
-    }
-    
-    return "Unknown";
+    const std::string_view vendor = OuiRegistry::instance().lookup(bssid);
+    return vendor.empty() ? "Unknown" : std::string(vendor);
 }
 
 int LinuxWifiScanner::estimateChannelWidth(int frequency) const {
@@ -431,14 +524,4 @@ bool LinuxWifiScanner::checkForWPS(const std::string& capabilities) const {
     return (lower.find("wps") != std::string::npos);
 }
 
-int LinuxWifiScanner::estimateDataRate(int frequency, int channelWidth) const {
-    if (frequency >= 6000) {
-        return channelWidth * 8; // 6GHz - Wi-Fi 6E
-    } else if (frequency >= 5000) {
-        return channelWidth * 6; // 5GHz - Wi-Fi 5/6
-    } else {
-        return channelWidth * 4; // 2.4GHz - Wi-Fi 4
-    }
-}
-
 } // namespace WifiScanner
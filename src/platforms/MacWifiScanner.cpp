@@ -1,5 +1,8 @@
 #ifdef __APPLE__
 #include "platforms/MacWifiScanner.h"
+#include "OuiRegistry.h"
+#include "SsidClassifier.h"
+#include "VendorRegistry.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -70,6 +73,7 @@ std::vector<NetworkInfo> MacWifiScanner::scan() {
                 info.bssid = [bssid UTF8String];
                 // Extract vendor from BSSID (first 6 characters)
                 info.vendor = extractVendorFromBSSID([bssid UTF8String]);
+                info.vendorId = VendorRegistry::instance().intern(info.vendor);
             } else {
                 info.bssid = "Unknown";
             }
@@ -219,45 +223,14 @@ int MacWifiScanner::channelToFrequency(int channel) const {
 }
 
 bool MacWifiScanner::detectGuestNetwork(const std::string& ssid) const {
-    std::string lowerSSID = ssid;
-    std::transform(lowerSSID.begin(), lowerSSID.end(), lowerSSID.begin(), ::tolower);
-    
-    // Common guest network patterns
-    std::vector<std::string> guestPatterns = {
-        "guest", "visitor", "public", "hotel", "cafe", "restaurant",
-        "airport", "mall", "library", "university", "college",
-        "temporary", "temp", "test", "demo"
-    };
-    
-    for (const auto& pattern : guestPatterns) {
-        if (lowerSSID.find(pattern) != std::string::npos) {
-            return true;
-        }
-    }
-    
-    return false;
+    return SsidClassifier::instance().matches(ssid, SsidCategory::GUEST);
 }
 
 std::string MacWifiScanner::extractVendorFromBSSID(const std::string& bssid) const {
     if (bssid.length() < 8) return "";
     
-    // Extract first 6 characters (OUI - Organizationally Unique Identifier)
-    std::string oui = bssid.substr(0, 8);
-    
-    // Common vendor OUIs (simplified - in a real app you'd use a database)
-    if (oui.substr(0, 8) == "00:1A:11" || oui.substr(0, 8) == "00:1A:11") {
-        return "Google";
-    } else if (oui.substr(0, 8) == "00:1B:63" || oui.substr(0, 8) == "00:1B:63") {
-        return "Apple";
-    } else if (oui.substr(0, 8) == "00:1C:C0" || oui.substr(0, 8) == "00:1C:C0") {
-        return "Cisco";
-    } else if (oui.substr(0, 8) == "00:1D:7E" || oui.substr(0, 8) == "00:1D:7E") {
-        return "Netgear";
-    } else if (oui.substr(0, 8) == "00:1E:40" || oui.substr(0, 8) == "00:1E:40") {
-        return "Asus";
-    }
-    
-    return "Unknown";
+    const std::string_view vendor = OuiRegistry::instance().lookup(bssid);
+    return vendor.empty() ? "Unknown" : std::string(vendor);
 }
 
 int MacWifiScanner::estimateChannelWidth(const void* capabilities) const {
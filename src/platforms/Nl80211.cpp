@@ -0,0 +1,626 @@
+#include "platforms/Nl80211.h"
+#include "platforms/ScanDecoding.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <linux/genetlink.h>
+#include <linux/netlink.h>
+#include <linux/nl80211.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace WifiScanner {
+
+namespace {
+
+// An error reply from the kernel, keeping the errno it carried
+struct NetlinkError : std::runtime_error {
+    int code;
+    explicit NetlinkError(int code)
+        : std::runtime_error(std::string("netlink: ") + std::strerror(code)), code(code) {}
+};
+
+struct Attribute {
+    uint16_t type;
+    const uint8_t* data;
+    size_t length;
+};
+
+template<typename T>
+T read(const Attribute& attribute) {
+    T value{};
+    std::memcpy(&value, attribute.data, std::min(sizeof(T), attribute.length));
+    return value;
+}
+
+// Visit the attributes in [data, data + length); throws if one overruns the buffer
+template<typename OnAttribute>
+void forEachAttribute(const uint8_t* data, size_t length, OnAttribute&& onAttribute) {
+    size_t offset = 0;
+    while (length - offset >= NLA_HDRLEN) {
+        nlattr header;
+        std::memcpy(&header, data + offset, sizeof(header));
+        if (header.nla_len < NLA_HDRLEN || header.nla_len > length - offset) {
+            throw std::runtime_error("malformed netlink attribute");
+        }
+        onAttribute(Attribute{static_cast<uint16_t>(header.nla_type & NLA_TYPE_MASK),
+                              data + offset + NLA_HDRLEN, static_cast<size_t>(header.nla_len - NLA_HDRLEN)});
+        offset += std::min<size_t>(NLA_ALIGN(header.nla_len), length - offset);
+    }
+}
+
+// Visit the messages in one receive buffer as (type, payload, payload length).
+// Returns true once the request is complete: NLMSG_DONE for a dump, an ack
+// otherwise. Error replies throw NetlinkError.
+template<typename OnMessage>
+bool forEachMessage(const uint8_t* data, size_t length, OnMessage&& onMessage) {
+    size_t offset = 0;
+    while (offset < length) {
+        nlmsghdr header;
+        if (length - offset < sizeof(header)) {
+            throw std::runtime_error("truncated netlink message");
+        }
+        std::memcpy(&header, data + offset, sizeof(header));
+        if (header.nlmsg_len < NLMSG_HDRLEN || header.nlmsg_len > length - offset) {
+            throw std::runtime_error("truncated netlink message");
+        }
+        const uint8_t* payload = data + offset + NLMSG_HDRLEN;
+        const size_t payloadLength = header.nlmsg_len - NLMSG_HDRLEN;
+
+        if (header.nlmsg_type == NLMSG_DONE) {
+            return true;
+        } else if (header.nlmsg_type == NLMSG_ERROR) {
+            int error;
+            if (payloadLength < sizeof(error)) {
+                throw std::runtime_error("truncated netlink error");
+            }
+            std::memcpy(&error, payload, sizeof(error));
+            if (error != 0) {
+                throw NetlinkError(-error);
+            }
+            return true;
+        } else if (header.nlmsg_type != NLMSG_NOOP) {
+            onMessage(header.nlmsg_type, payload, payloadLength);
+        }
+        offset += std::min<size_t>(NLMSG_ALIGN(header.nlmsg_len), length - offset);
+    }
+    return false;
+}
+
+// Split a generic-netlink payload into its command and attributes; false if too short
+bool genericPayload(const uint8_t* payload, size_t length, uint8_t& command,
+                    const uint8_t*& attributes, size_t& attributesLength) {
+    if (length < GENL_HDRLEN) {
+        return false;
+    }
+    genlmsghdr header;
+    std::memcpy(&header, payload, sizeof(header));
+    command = header.cmd;
+    attributes = payload + GENL_HDRLEN;
+    attributesLength = length - GENL_HDRLEN;
+    return true;
+}
+
+void putAttribute(std::vector<uint8_t>& message, uint16_t type, const void* data, size_t length) {
+    nlattr header;
+    header.nla_len = static_cast<uint16_t>(NLA_HDRLEN + length);
+    header.nla_type = type;
+    const size_t start = message.size();
+    message.resize(start + NLA_ALIGN(header.nla_len), 0);
+    std::memcpy(&message[start], &header, sizeof(header));
+    std::memcpy(&message[start + NLA_HDRLEN], data, length);
+}
+
+// Spatial streams in a VHT/HE MCS map: two bits per stream, 3 = unsupported
+int streamsInMcsMap(uint16_t map) {
+    int streams = 0;
+    for (int stream = 0; stream < 8; ++stream) {
+        if (((map >> (stream * 2)) & 3) != 3) {
+            streams = stream + 1;
+        }
+    }
+    return streams;
+}
+
+// RSN and WPA share a layout after the version: group cipher, pairwise
+// ciphers, AKM suites, then (RSN only) the capabilities field
+void parseSecurityElement(const uint8_t* data, size_t length, const uint8_t oui[3],
+                          uint32_t& akms, uint32_t& ciphers, BssCapabilities* rsn) {
+    size_t offset = 2;  // Version
+    auto suite = [&](uint32_t& bits) {
+        if (std::memcmp(data + offset, oui, 3) == 0 && data[offset + 3] < 32) {
+            bits |= 1u << data[offset + 3];
+        }
+        offset += 4;
+    };
+    auto suiteList = [&](uint32_t& bits) {
+        if (length - offset < 2) {
+            return false;
+        }
+        const size_t count = data[offset] | (data[offset + 1] << 8);
+        offset += 2;
+        for (size_t i = 0; i < count && length - offset >= 4; ++i) {
+            suite(bits);
+        }
+        return true;
+    };
+
+    if (length < offset + 4) {
+        return;
+    }
+    uint32_t group = 0;
+    suite(group);
+    ciphers |= group;
+    if (!suiteList(ciphers) || !suiteList(akms)) {
+        return;
+    }
+    if (rsn && length - offset >= 2) {
+        const uint16_t capabilities = data[offset] | (data[offset + 1] << 8);
+        rsn->mfpRequired = capabilities & 0x0040;
+        rsn->mfpCapable = capabilities & 0x0080;
+    }
+}
+
+void parseElements(const uint8_t* data, size_t length, NetworkInfo& network, BssCapabilities& elements) {
+    static const uint8_t IEEE_OUI[3] = {0x00, 0x0F, 0xAC};
+    static const uint8_t MICROSOFT_OUI[3] = {0x00, 0x50, 0xF2};
+    static const uint8_t WFA_OUI[3] = {0x50, 0x6F, 0x9A};
+    bool hasSsid = false;
+    int vhtWidth = 0;
+    int heWidth = 0;
+
+    size_t offset = 0;
+    while (length - offset >= 2) {
+        const uint8_t id = data[offset];
+        const size_t size = data[offset + 1];
+        if (size > length - offset - 2) {
+            break;  // Truncated element: keep what was decoded so far
+        }
+        const uint8_t* body = data + offset + 2;
+
+        switch (id) {
+            case 0:  // SSID
+                if (!hasSsid) {
+                    hasSsid = true;
+                    network.ssid.assign(reinterpret_cast<const char*>(body), size);
+                }
+                break;
+            case 1:   // Supported rates
+            case 50:  // Extended supported rates
+                for (size_t i = 0; i < size; ++i) {
+                    elements.legacyRate = std::max(elements.legacyRate, body[i] & 0x7F);
+                }
+                break;
+            case 45:  // HT capabilities
+                if (size >= 7) {
+                    elements.htStreams = 0;
+                    for (int stream = 0; stream < 4; ++stream) {
+                        if (body[3 + stream]) {
+                            elements.htStreams = stream + 1;
+                        }
+                    }
+                }
+                break;
+            case 48:  // RSN
+                elements.rsn = true;
+                parseSecurityElement(body, size, IEEE_OUI, elements.rsnAkms, elements.rsnCiphers, &elements);
+                break;
+            case 61:  // HT operation
+                if (size >= 2 && (body[1] & 0x04)) {
+                    elements.width = std::max(elements.width, 40);
+                }
+                break;
+            case 191:  // VHT capabilities
+                if (size >= 6) {
+                    elements.vhtStreams = streamsInMcsMap(body[4] | (body[5] << 8));
+                }
+                break;
+            case 192:  // VHT operation
+                if (size >= 3) {
+                    const int gap = std::abs(body[2] - body[1]);
+                    if (body[0] == 1) {
+                        vhtWidth = (body[2] != 0 && (gap == 8 || gap > 16)) ? 160 : 80;
+                    } else if (body[0] == 2 || body[0] == 3) {
+                        vhtWidth = 160;
+                    }
+                }
+                break;
+            case 221:  // Vendor specific
+                if (size >= 4 && std::memcmp(body, MICROSOFT_OUI, 3) == 0) {
+                    if (body[3] == 1) {
+                        elements.wpa = true;
+                        parseSecurityElement(body + 4, size - 4, MICROSOFT_OUI,
+                                             elements.wpaAkms, elements.wpaCiphers, nullptr);
+                    } else if (body[3] == 4) {
+                        elements.wps = true;
+                    }
+                } else if (size >= 4 && std::memcmp(body, WFA_OUI, 3) == 0 && body[3] == 0x1C) {
+                    elements.oweTransition = true;
+                }
+                break;
+            case 255:  // Element ID extension
+                if (size >= 1 + 6 + 11 + 2 && body[0] == 35) {  // HE capabilities
+                    elements.heStreams = streamsInMcsMap(body[18] | (body[19] << 8));
+                } else if (size >= 1 + 6 && body[0] == 36) {    // HE operation
+                    const uint32_t parameters = body[1] | (body[2] << 8) | (body[3] << 16);
+                    size_t info = 1 + 6;
+                    info += (parameters & (1u << 14)) ? 3 : 0;  // VHT operation information
+                    info += (parameters & (1u << 15)) ? 1 : 0;  // Co-hosted BSS
+                    if ((parameters & (1u << 17)) && size >= info + 2) {  // 6 GHz operation information
+                        heWidth = 20 << (body[info + 1] & 3);
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+        offset += 2 + size;
+    }
+    elements.width = std::max({elements.width, vhtWidth, heWidth});
+}
+
+void formatBssid(const uint8_t* address, std::string& out) {
+    static const char digits[] = "0123456789ABCDEF";
+    out.resize(17);
+    for (int i = 0; i < 6; ++i) {
+        out[i * 3] = digits[address[i] >> 4];
+        out[i * 3 + 1] = digits[address[i] & 0xF];
+        if (i < 5) out[i * 3 + 2] = ':';
+    }
+}
+
+class FileDescriptor {
+public:
+    explicit FileDescriptor(int fd) : fd_(fd) {}
+    ~FileDescriptor() { if (fd_ >= 0) ::close(fd_); }
+    int get() const { return fd_; }
+private:
+    int fd_;
+};
+
+int openNetlink() {
+    int fd = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_GENERIC);
+    if (fd < 0) {
+        return -1;
+    }
+    sockaddr_nl local{};
+    local.nl_family = AF_NETLINK;
+    timeval timeout{5, 0};  // A reply that never comes fails the scan instead of hanging it
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0 ||
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+constexpr size_t RECEIVE_BUFFER_SIZE = 64 * 1024;
+
+} // namespace
+
+Nl80211ScanDecoder::Nl80211ScanDecoder(NetworkSink sink) : sink_(std::move(sink)) {}
+
+bool Nl80211ScanDecoder::feed(const void* data, size_t length) {
+    if (done_) {
+        return false;
+    }
+    done_ = forEachMessage(static_cast<const uint8_t*>(data), length,
+        [this](uint16_t, const uint8_t* payload, size_t payloadLength) {
+            uint8_t command;
+            const uint8_t* attributes;
+            size_t attributesLength;
+            if (!genericPayload(payload, payloadLength, command, attributes, attributesLength) ||
+                command != NL80211_CMD_NEW_SCAN_RESULTS) {
+                return;
+            }
+            forEachAttribute(attributes, attributesLength, [this](const Attribute& attribute) {
+                if (attribute.type == NL80211_ATTR_BSS) {
+                    decodeBss(attribute.data, attribute.length);
+                }
+            });
+        });
+    return !done_;
+}
+
+void Nl80211ScanDecoder::decodeBss(const uint8_t* data, size_t length) {
+    resetNetwork(network_);
+    Attribute elements{0, nullptr, 0};
+    Attribute beaconElements{0, nullptr, 0};
+    BssCapabilities parsed;
+    bool hasBssid = false;
+    bool hasSignal = false;
+
+    forEachAttribute(data, length, [&](const Attribute& attribute) {
+        switch (attribute.type) {
+            case NL80211_BSS_BSSID:
+                if (attribute.length >= 6) {
+                    formatBssid(attribute.data, network_.bssid);
+                    hasBssid = true;
+                }
+                break;
+            case NL80211_BSS_FREQUENCY:
+                network_.frequency = static_cast<int>(read<uint32_t>(attribute));
+                break;
+            case NL80211_BSS_SIGNAL_MBM:
+                network_.signalStrength = read<int32_t>(attribute) / 100;
+                hasSignal = true;
+                break;
+            case NL80211_BSS_SIGNAL_UNSPEC:
+                if (!hasSignal) {
+                    network_.signalStrength = read<uint8_t>(attribute) / 2 - 100;  // 0-100 quality
+                }
+                break;
+            case NL80211_BSS_BEACON_INTERVAL:
+                network_.beaconInterval = read<uint16_t>(attribute);
+                break;
+            case NL80211_BSS_CAPABILITY:
+                parsed.capability = read<uint16_t>(attribute);
+                break;
+            case NL80211_BSS_INFORMATION_ELEMENTS:
+                elements = attribute;
+                break;
+            case NL80211_BSS_BEACON_IES:
+                beaconElements = attribute;
+                break;
+            default:
+                break;
+        }
+    });
+    if (!hasBssid) {
+        return;
+    }
+
+    // Probe response elements are the more complete set; beacons are the fallback
+    const Attribute& source = elements.data ? elements : beaconElements;
+    if (source.data) {
+        parseElements(source.data, source.length, network_, parsed);
+    }
+    network_.isHidden = network_.ssid.empty() ||
+                        std::all_of(network_.ssid.begin(), network_.ssid.end(), [](char c) { return c == '\0'; });
+    if (network_.isHidden) {
+        network_.ssid.clear();
+    }
+    network_.channel = channelForFrequency(network_.frequency);
+    applyBssCapabilities(parsed, network_);
+
+    sink_(network_);
+    ++count_;
+}
+
+Nl80211Socket::Nl80211Socket() : buffer_(RECEIVE_BUFFER_SIZE) {
+    fd_ = openNetlink();
+    if (fd_ < 0) {
+        throw std::runtime_error(std::string("cannot open generic netlink socket: ") + std::strerror(errno));
+    }
+    try {
+        resolveFamily();
+    } catch (...) {
+        ::close(fd_);
+        throw;
+    }
+}
+
+Nl80211Socket::~Nl80211Socket() {
+    ::close(fd_);
+}
+
+std::vector<uint8_t> Nl80211Socket::request(uint16_t type, uint16_t flags, uint8_t command) {
+    std::vector<uint8_t> message(NLMSG_HDRLEN + GENL_HDRLEN, 0);
+    nlmsghdr header{};
+    header.nlmsg_type = type;
+    header.nlmsg_flags = flags;
+    header.nlmsg_seq = ++sequence_;
+    genlmsghdr generic{};
+    generic.cmd = command;
+    generic.version = 1;
+    std::memcpy(message.data(), &header, sizeof(header));
+    std::memcpy(message.data() + NLMSG_HDRLEN, &generic, sizeof(generic));
+    return message;
+}
+
+void Nl80211Socket::send(std::vector<uint8_t>& message) {
+    const uint32_t length = static_cast<uint32_t>(message.size());
+    std::memcpy(message.data() + offsetof(nlmsghdr, nlmsg_len), &length, sizeof(length));
+    sockaddr_nl kernel{};
+    kernel.nl_family = AF_NETLINK;
+    if (::sendto(fd_, message.data(), message.size(), 0, reinterpret_cast<sockaddr*>(&kernel), sizeof(kernel)) < 0) {
+        throw std::runtime_error(std::string("netlink send failed: ") + std::strerror(errno));
+    }
+}
+
+size_t Nl80211Socket::receive(int fd) {
+    for (;;) {
+        const ssize_t received = ::recv(fd, buffer_.data(), buffer_.size(), 0);
+        if (received > 0) {
+            return static_cast<size_t>(received);
+        }
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        throw std::runtime_error(std::string("netlink receive failed: ") +
+                                 (received == 0 ? "socket closed" : std::strerror(errno)));
+    }
+}
+
+void Nl80211Socket::resolveFamily() {
+    auto message = request(GENL_ID_CTRL, NLM_F_REQUEST | NLM_F_ACK, CTRL_CMD_GETFAMILY);
+    static const char name[] = NL80211_GENL_NAME;
+    putAttribute(message, CTRL_ATTR_FAMILY_NAME, name, sizeof(name));
+    send(message);
+
+    bool complete = false;
+    while (!complete) {
+        const size_t received = receive(fd_);
+        try {
+            complete = forEachMessage(buffer_.data(), received, [this](uint16_t, const uint8_t* payload, size_t length) {
+                uint8_t command;
+                const uint8_t* attributes;
+                size_t attributesLength;
+                if (!genericPayload(payload, length, command, attributes, attributesLength)) {
+                    return;
+                }
+                forEachAttribute(attributes, attributesLength, [this](const Attribute& attribute) {
+                    if (attribute.type == CTRL_ATTR_FAMILY_ID) {
+                        familyId_ = read<uint16_t>(attribute);
+                    } else if (attribute.type == CTRL_ATTR_MCAST_GROUPS) {
+                        forEachAttribute(attribute.data, attribute.length, [this](const Attribute& group) {
+                            std::string groupName;
+                            uint32_t id = 0;
+                            forEachAttribute(group.data, group.length, [&](const Attribute& field) {
+                                if (field.type == CTRL_ATTR_MCAST_GRP_NAME) {
+                                    groupName.assign(reinterpret_cast<const char*>(field.data),
+                                                     strnlen(reinterpret_cast<const char*>(field.data), field.length));
+                                } else if (field.type == CTRL_ATTR_MCAST_GRP_ID) {
+                                    id = read<uint32_t>(field);
+                                }
+                            });
+                            if (groupName == NL80211_MULTICAST_GROUP_SCAN) {
+                                scanGroup_ = id;
+                            }
+                        });
+                    }
+                });
+            });
+        } catch (const NetlinkError&) {
+            throw std::runtime_error("nl80211 is not available (no cfg80211 wireless devices)");
+        }
+    }
+    if (familyId_ == 0) {
+        throw std::runtime_error("nl80211 family id missing from the controller reply");
+    }
+}
+
+std::vector<Nl80211Socket::Interface> Nl80211Socket::interfaces() {
+    auto message = request(familyId_, NLM_F_REQUEST | NLM_F_DUMP, NL80211_CMD_GET_INTERFACE);
+    send(message);
+
+    std::vector<Interface> result;
+    bool complete = false;
+    while (!complete) {
+        const size_t received = receive(fd_);
+        complete = forEachMessage(buffer_.data(), received, [&result](uint16_t, const uint8_t* payload, size_t length) {
+            uint8_t command;
+            const uint8_t* attributes;
+            size_t attributesLength;
+            if (!genericPayload(payload, length, command, attributes, attributesLength)) {
+                return;
+            }
+            Interface interface{0, ""};
+            uint32_t type = NL80211_IFTYPE_UNSPECIFIED;
+            forEachAttribute(attributes, attributesLength, [&](const Attribute& attribute) {
+                if (attribute.type == NL80211_ATTR_IFINDEX) {
+                    interface.index = static_cast<int>(read<uint32_t>(attribute));
+                } else if (attribute.type == NL80211_ATTR_IFNAME) {
+                    interface.name.assign(reinterpret_cast<const char*>(attribute.data),
+                                          strnlen(reinterpret_cast<const char*>(attribute.data), attribute.length));
+                } else if (attribute.type == NL80211_ATTR_IFTYPE) {
+                    type = read<uint32_t>(attribute);
+                }
+            });
+            // Devices without a netdev (e.g. P2P) have no index and cannot scan
+            if (interface.index > 0 && type == NL80211_IFTYPE_STATION) {
+                result.push_back(std::move(interface));
+            }
+        });
+    }
+    return result;
+}
+
+bool Nl80211Socket::triggerScan(int ifindex, const std::vector<int>& frequencies,
+                                std::chrono::milliseconds timeout) {
+    if (scanGroup_ == 0) {
+        return false;
+    }
+
+    // Listen before triggering so the completion event cannot be missed
+    FileDescriptor events(openNetlink());
+    if (events.get() < 0 ||
+        ::setsockopt(events.get(), SOL_NETLINK, NETLINK_ADD_MEMBERSHIP, &scanGroup_, sizeof(scanGroup_)) != 0) {
+        return false;
+    }
+
+    auto message = request(familyId_, NLM_F_REQUEST | NLM_F_ACK, NL80211_CMD_TRIGGER_SCAN);
+    const uint32_t index = static_cast<uint32_t>(ifindex);
+    putAttribute(message, NL80211_ATTR_IFINDEX, &index, sizeof(index));
+    if (!frequencies.empty()) {
+        // Nested list of u32 attributes, numbered from 1
+        std::vector<uint8_t> nested;
+        for (size_t i = 0; i < frequencies.size(); ++i) {
+            const uint32_t frequency = static_cast<uint32_t>(frequencies[i]);
+            putAttribute(nested, static_cast<uint16_t>(i + 1), &frequency, sizeof(frequency));
+        }
+        putAttribute(message, NL80211_ATTR_SCAN_FREQUENCIES, nested.data(), nested.size());
+    }
+    send(message);
+    try {
+        while (!forEachMessage(buffer_.data(), receive(fd_), [](uint16_t, const uint8_t*, size_t) {})) {
+        }
+    } catch (const NetlinkError& e) {
+        if (e.code != EBUSY) {  // EBUSY: a scan is already running, so wait for that one
+            return false;
+        }
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    for (;;) {
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0) {
+            return false;
+        }
+        pollfd waiting{events.get(), POLLIN, 0};
+        const int ready = ::poll(&waiting, 1, static_cast<int>(remaining.count()));
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            return false;
+        }
+
+        bool finished = false;
+        bool succeeded = false;
+        forEachMessage(buffer_.data(), receive(events.get()), [&](uint16_t, const uint8_t* payload, size_t length) {
+            uint8_t command;
+            const uint8_t* attributes;
+            size_t attributesLength;
+            if (!genericPayload(payload, length, command, attributes, attributesLength) ||
+                (command != NL80211_CMD_NEW_SCAN_RESULTS && command != NL80211_CMD_SCAN_ABORTED)) {
+                return;
+            }
+            forEachAttribute(attributes, attributesLength, [&](const Attribute& attribute) {
+                if (attribute.type == NL80211_ATTR_IFINDEX && read<uint32_t>(attribute) == index) {
+                    finished = true;
+                    succeeded = command == NL80211_CMD_NEW_SCAN_RESULTS;
+                }
+            });
+        });
+        if (finished) {
+            return succeeded;
+        }
+    }
+}
+
+size_t Nl80211Socket::dumpScanResults(int ifindex, const Nl80211ScanDecoder::NetworkSink& sink) {
+    auto message = request(familyId_, NLM_F_REQUEST | NLM_F_DUMP, NL80211_CMD_GET_SCAN);
+    const uint32_t index = static_cast<uint32_t>(ifindex);
+    putAttribute(message, NL80211_ATTR_IFINDEX, &index, sizeof(index));
+    send(message);
+
+    Nl80211ScanDecoder decoder(sink);
+    bool more = true;
+    while (more) {
+        const size_t received = receive(fd_);
+        if (capture_) {
+            capture_->write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(received));
+        }
+        more = decoder.feed(buffer_.data(), received);
+    }
+    return decoder.count();
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,172 @@
+#include "platforms/ReplayWifiScanner.h"
+#include "platforms/ScanDecoding.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace WifiScanner {
+
+namespace {
+
+std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("cannot open recording " + path);
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+ReplayFormat parseFormat(std::string_view name, const std::string& source) {
+    if (name == "iw") return ReplayFormat::IW;
+    if (name == "nmcli") return ReplayFormat::NMCLI;
+    if (name == "nl80211") return ReplayFormat::NL80211;
+    if (name == "snapshot") return ReplayFormat::SNAPSHOT;
+    throw std::runtime_error(source + ": unknown recording format '" + std::string(name) + "'");
+}
+
+} // namespace
+
+ReplayWifiScanner::ReplayWifiScanner(const std::string& path, ReplayTiming timing)
+    : ReplayWifiScanner(std::vector<ReplayFrame>{{path, detectFormat(readFile(path)), std::chrono::milliseconds(0)}},
+                        timing) {
+}
+
+ReplayWifiScanner::ReplayWifiScanner(const std::vector<ReplayFrame>& frames, ReplayTiming timing)
+    : timing_(timing) {
+    frames_.reserve(frames.size());
+    for (const auto& frame : frames) {
+        LoadedFrame loaded{frame.format, frame.offset, std::string(), nullptr};
+        if (frame.format == ReplayFormat::SNAPSHOT) {
+            loaded.snapshot = std::make_unique<SnapshotTable>(frame.path);
+        } else {
+            loaded.contents = readFile(frame.path);
+            if (frame.format == ReplayFormat::NL80211) {
+                parser_.parseNl80211Dump(loaded.contents, [](const NetworkInfo&) {});  // Throws if malformed
+            }
+        }
+        frames_.push_back(std::move(loaded));
+    }
+}
+
+ReplayWifiScanner::~ReplayWifiScanner() = default;
+
+std::vector<ReplayFrame> ReplayWifiScanner::loadManifest(const std::string& path) {
+    const std::string contents = readFile(path);
+    const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+
+    std::vector<ReplayFrame> frames;
+    const std::string_view text(contents);
+    size_t position = 0;
+    std::string_view line;
+    int lineNumber = 0;
+    while (nextLine(text, position, line)) {
+        ++lineNumber;
+        line = trimLeft(line.substr(0, line.find('#')));
+        if (line.empty()) {
+            continue;
+        }
+
+        const std::string source = path + ":" + std::to_string(lineNumber);
+        std::istringstream fields{std::string(line)};
+        long long offset = 0;
+        std::string file;
+        std::string format;
+        if (!(fields >> offset >> file) || offset < 0) {
+            throw std::runtime_error(source + ": expected '<offset in ms> <file> [format]'");
+        }
+        fields >> format;
+
+        std::filesystem::path recording(file);
+        if (recording.is_relative()) {
+            recording = directory / recording;
+        }
+        ReplayFrame frame;
+        frame.path = recording.string();
+        frame.offset = std::chrono::milliseconds(offset);
+        frame.format = format.empty() ? detectFormat(readFile(frame.path)) : parseFormat(format, source);
+        frames.push_back(std::move(frame));
+    }
+    return frames;
+}
+
+std::unique_ptr<ReplayWifiScanner> ReplayWifiScanner::open(const std::string& path, ReplayTiming timing) {
+    if (std::filesystem::path(path).extension() == ".replay") {
+        return std::make_unique<ReplayWifiScanner>(loadManifest(path), timing);
+    }
+    return std::make_unique<ReplayWifiScanner>(path, timing);
+}
+
+ReplayFormat ReplayWifiScanner::detectFormat(const std::string& contents) {
+    if (contents.size() >= sizeof(SnapshotTable::MAGIC) &&
+        std::memcmp(contents.data(), SnapshotTable::MAGIC, sizeof(SnapshotTable::MAGIC)) == 0) {
+        return ReplayFormat::SNAPSHOT;
+    }
+    // Text output never holds NUL bytes; every netlink header does
+    if (contents.find('\0') != std::string::npos) {
+        return ReplayFormat::NL80211;
+    }
+    size_t position = 0;
+    std::string_view line;
+    while (nextLine(contents, position, line)) {
+        if (!line.empty()) {
+            return line.substr(0, 4) == "BSS " ? ReplayFormat::IW : ReplayFormat::NMCLI;
+        }
+    }
+    return ReplayFormat::NMCLI;
+}
+
+std::vector<NetworkInfo> ReplayWifiScanner::scan() {
+    std::vector<NetworkInfo> networks;
+    if (frames_.empty()) {
+        return networks;
+    }
+
+    if (next_ == 0) {
+        start_ = std::chrono::steady_clock::now();
+    }
+    const LoadedFrame& frame = frames_[next_];
+    if (timing_ == ReplayTiming::ORIGINAL) {
+        std::this_thread::sleep_until(start_ + frame.offset);
+    }
+
+    switch (frame.format) {
+        case ReplayFormat::IW:
+            networks = parser_.parseIwScanOutput(frame.contents);
+            break;
+        case ReplayFormat::NMCLI:
+            networks = parser_.parseNmcliOutput(frame.contents);
+            break;
+        case ReplayFormat::NL80211:
+            networks = parser_.parseNl80211Dump(frame.contents);
+            break;
+        case ReplayFormat::SNAPSHOT:
+            networks.reserve(frame.snapshot->size());
+            for (size_t i = 0; i < frame.snapshot->size(); ++i) {
+                networks.push_back(frame.snapshot->networkAt(i));
+            }
+            break;
+    }
+
+    next_ = (next_ + 1) % frames_.size();
+    ++sweeps_;
+    return networks;
+}
+
+bool ReplayWifiScanner::isSupported() const {
+    return !frames_.empty();
+}
+
+std::string ReplayWifiScanner::getPlatformName() const {
+    return "Replay";
+}
+
+void ReplayWifiScanner::rewind() {
+    next_ = 0;
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,132 @@
+#include "platforms/ScanBackends.h"
+#include "platforms/Nl80211.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <unistd.h>
+
+namespace WifiScanner {
+
+namespace {
+
+const ScanBackend ALL_BACKENDS[] = {
+    ScanBackend::NL80211, ScanBackend::NETWORK_MANAGER, ScanBackend::IW, ScanBackend::PROC_NET
+};
+
+// Same lookup as `which`, without starting a shell
+bool onPath(const char* program) {
+    const char* path = std::getenv("PATH");
+    if (!path) {
+        return false;
+    }
+    std::string candidate;
+    for (const char* start = path;; ) {
+        const char* end = start;
+        while (*end && *end != ':') {
+            ++end;
+        }
+        candidate.assign(start, end);
+        candidate += candidate.empty() ? "./" : "/";
+        candidate += program;
+        if (access(candidate.c_str(), X_OK) == 0) {
+            return true;
+        }
+        if (!*end) {
+            return false;
+        }
+        start = end + 1;
+    }
+}
+
+// /proc/net/wireless has two header lines, then one line per wireless interface
+bool hasWirelessInterface() {
+    std::ifstream file("/proc/net/wireless");
+    std::string line;
+    int lines = 0;
+    while (lines < 3 && std::getline(file, line)) {
+        ++lines;
+    }
+    return lines == 3;
+}
+
+} // namespace
+
+ScanBackendRegistry& ScanBackendRegistry::instance() {
+    static ScanBackendRegistry registry(&ScanBackendRegistry::probeSystem);
+    return registry;
+}
+
+ScanBackendRegistry::ScanBackendRegistry(Probe probe) : probe_(std::move(probe)) {}
+
+std::optional<ScanBackend> ScanBackendRegistry::best() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ensureProbed();
+    if (available_.empty()) {
+        return std::nullopt;
+    }
+    return available_.front();
+}
+
+std::vector<ScanBackend> ScanBackendRegistry::available() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ensureProbed();
+    return available_;
+}
+
+bool ScanBackendRegistry::isAvailable(ScanBackend backend) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ensureProbed();
+    return std::find(available_.begin(), available_.end(), backend) != available_.end();
+}
+
+void ScanBackendRegistry::refresh() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    probed_ = false;
+}
+
+void ScanBackendRegistry::ensureProbed() const {
+    if (probed_) {
+        return;
+    }
+    available_.clear();
+    for (ScanBackend backend : ALL_BACKENDS) {
+        if (probe_(backend)) {
+            available_.push_back(backend);
+        }
+    }
+    probed_ = true;
+}
+
+const char* ScanBackendRegistry::name(ScanBackend backend) {
+    switch (backend) {
+        case ScanBackend::NL80211: return "nl80211";
+        case ScanBackend::NETWORK_MANAGER: return "NetworkManager";
+        case ScanBackend::IW: return "iw";
+        case ScanBackend::PROC_NET: return "/proc/net/wireless";
+    }
+    return "unknown";
+}
+
+bool ScanBackendRegistry::probeSystem(ScanBackend backend) {
+    switch (backend) {
+        case ScanBackend::NL80211:
+            try {
+                Nl80211Socket socket;
+                return !socket.interfaces().empty();
+            } catch (const std::runtime_error&) {
+                return false;
+            }
+        case ScanBackend::NETWORK_MANAGER:
+            return onPath("nmcli");
+        case ScanBackend::IW:
+            return onPath("iw");
+        case ScanBackend::PROC_NET:
+            return hasWirelessInterface();
+    }
+    return false;
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,200 @@
+#include "platforms/ScanDecoding.h"
+#include <algorithm>
+#include <charconv>
+#include <initializer_list>
+#include <utility>
+
+namespace WifiScanner {
+
+namespace {
+
+// Per-stream PHY rates in Mbps at the highest MCS and shortest guard interval
+int streamRate(int generation, int width) {
+    static const int rates[3][4] = {
+        {72, 150, 150, 150},    // HT: 20/40 MHz only
+        {87, 200, 433, 867},    // VHT
+        {143, 287, 601, 1201}   // HE
+    };
+    const int column = width >= 160 ? 3 : width >= 80 ? 2 : width >= 40 ? 1 : 0;
+    return rates[generation][column];
+}
+
+void describeCiphers(std::string& out, uint32_t ciphers) {
+    static const std::pair<int, const char*> names[] = {
+        {4, "CCMP"}, {10, "CCMP-256"}, {8, "GCMP"}, {9, "GCMP-256"}, {2, "TKIP"}
+    };
+    bool first = true;
+    for (const auto& name : names) {
+        if (ciphers & (1u << name.first)) {
+            out += first ? "-" : "+";
+            out += name.second;
+            first = false;
+        }
+    }
+}
+
+bool hasSuite(uint32_t bits, std::initializer_list<int> suites) {
+    for (int suite : suites) {
+        if (bits & (1u << suite)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+void applyBssCapabilities(const BssCapabilities& bss, NetworkInfo& network) {
+    static const std::pair<int, const char*> rsnAkmNames[] = {
+        {1, "EAP"}, {2, "PSK"}, {3, "FT/EAP"}, {4, "FT/PSK"}, {5, "EAP-SHA256"}, {6, "PSK-SHA256"},
+        {8, "SAE"}, {9, "FT/SAE"}, {11, "EAP-SUITE-B"}, {12, "EAP-SUITE-B-192"}, {13, "FT/EAP-SHA384"},
+        {18, "OWE"}, {24, "SAE-EXT-KEY"}, {25, "FT/SAE-EXT-KEY"}
+    };
+
+    std::string& capabilities = network.capabilities;
+    capabilities.clear();
+    const uint32_t rsn = bss.rsnAkms;
+    if (bss.rsn) {
+        if (hasSuite(rsn, {11, 12, 13}) || (hasSuite(rsn, {5}) && bss.mfpRequired)) {
+            network.securityType = SecurityType::WPA3_ENTERPRISE;
+        } else if (hasSuite(rsn, {8, 9, 24, 25})) {
+            network.securityType = SecurityType::WPA3_PERSONAL;
+        } else if (hasSuite(rsn, {1, 3, 5})) {
+            network.securityType = SecurityType::WPA2_ENTERPRISE;
+        } else if (hasSuite(rsn, {2, 4, 6})) {
+            network.securityType = SecurityType::WPA2_PERSONAL;
+        } else if (hasSuite(rsn, {18})) {
+            network.securityType = SecurityType::OPEN;  // Enhanced Open: unauthenticated but encrypted
+        } else {
+            network.securityType = SecurityType::UNKNOWN;
+        }
+
+        capabilities += "[WPA2";
+        bool first = true;
+        for (const auto& name : rsnAkmNames) {
+            if (rsn & (1u << name.first)) {
+                capabilities += first ? "-" : "+";
+                capabilities += name.second;
+                first = false;
+            }
+        }
+        describeCiphers(capabilities, bss.rsnCiphers);
+        capabilities += "]";
+    } else if (bss.wpa) {
+        network.securityType = SecurityType::WPA;
+    } else if (bss.capability & 0x0010) {  // Privacy without RSN or WPA
+        network.securityType = SecurityType::WEP;
+        capabilities += "[WEP]";
+    } else {
+        network.securityType = SecurityType::OPEN;
+    }
+
+    if (bss.wpa) {
+        capabilities += (bss.wpaAkms & (1u << 1)) ? "[WPA-EAP" : "[WPA-PSK";
+        describeCiphers(capabilities, bss.wpaCiphers);
+        capabilities += "]";
+    }
+    network.isEnterprise = network.securityType == SecurityType::WPA2_ENTERPRISE ||
+                           network.securityType == SecurityType::WPA3_ENTERPRISE ||
+                           (network.securityType == SecurityType::WPA && (bss.wpaAkms & (1u << 1)));
+    network.supportsOWE = hasSuite(rsn, {18}) || bss.oweTransition;
+    network.supportsPMF = bss.mfpCapable || bss.mfpRequired;
+    network.supportsWPS = bss.wps;
+
+    if (network.supportsPMF) capabilities += bss.mfpRequired ? "[PMF-REQUIRED]" : "[PMF]";
+    if (network.supportsWPS) capabilities += "[WPS]";
+    if (bss.capability & 0x0001) capabilities += "[ESS]";
+    if (bss.capability & 0x0002) capabilities += "[IBSS]";
+
+    network.channelWidth = bss.width;
+    int rate = bss.legacyRate / 2;
+    const std::pair<int, int> generations[] = {{0, bss.htStreams}, {1, bss.vhtStreams}, {2, bss.heStreams}};
+    for (const auto& generation : generations) {
+        if (generation.second > 0) {
+            rate = std::max(rate, streamRate(generation.first, bss.width) * generation.second);
+        }
+    }
+    network.maxDataRate = rate;
+}
+
+int channelForFrequency(int frequency) {
+    if (frequency == 2484) {
+        return 14;
+    } else if (frequency >= 2412 && frequency < 2484) {
+        return (frequency - 2407) / 5;
+    } else if (frequency >= 5150 && frequency <= 5925) {
+        return (frequency - 5000) / 5;
+    } else if (frequency == 5935) {
+        return 2;
+    } else if (frequency > 5950 && frequency <= 7125) {
+        return (frequency - 5950) / 5;
+    }
+    return 0;
+}
+
+void resetNetwork(NetworkInfo& network) {
+    std::string ssid = std::move(network.ssid);
+    std::string bssid = std::move(network.bssid);
+    std::string capabilities = std::move(network.capabilities);
+    std::string vendor = std::move(network.vendor);
+    std::string radios = std::move(network.radios);
+    network = NetworkInfo();
+    ssid.clear();
+    bssid.clear();
+    capabilities.clear();
+    vendor.clear();
+    radios.clear();
+    network.ssid = std::move(ssid);
+    network.bssid = std::move(bssid);
+    network.capabilities = std::move(capabilities);
+    network.vendor = std::move(vendor);
+    network.radios = std::move(radios);
+}
+
+bool nextLine(std::string_view text, size_t& position, std::string_view& line) {
+    if (position >= text.size()) {
+        return false;
+    }
+    size_t end = text.find('\n', position);
+    if (end == std::string_view::npos) {
+        end = text.size();
+    }
+    line = text.substr(position, end - position);
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    position = end + 1;
+    return true;
+}
+
+std::string_view trimLeft(std::string_view text) {
+    size_t start = 0;
+    while (start < text.size() && (text[start] == ' ' || text[start] == '\t')) {
+        ++start;
+    }
+    return text.substr(start);
+}
+
+std::string_view trim(std::string_view text) {
+    text = trimLeft(text);
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r')) text.remove_suffix(1);
+    return text;
+}
+
+bool consumePrefix(std::string_view& text, std::string_view prefix) {
+    if (text.substr(0, prefix.size()) != prefix) {
+        return false;
+    }
+    text.remove_prefix(prefix.size());
+    return true;
+}
+
+bool parseNumber(std::string_view text, int& value) {
+    text = trimLeft(text);
+    if (!text.empty() && text.front() == '+') {
+        text.remove_prefix(1);
+    }
+    return std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc();
+}
+
+} // namespace WifiScanner
@@ -1,4 +1,7 @@
 #include "platforms/WindowsWifiScanner.h"
+#include "OuiRegistry.h"
+#include "SsidClassifier.h"
+#include "VendorRegistry.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -126,6 +129,7 @@ std::vector<NetworkInfo> WindowsWifiScanner::scan() {
                     
                     // Vendor detection
                     info.vendor = extractVendorFromBSSID(info.bssid);
+                    info.vendorId = VendorRegistry::instance().intern(info.vendor);
                     
                     // Channel width estimation
                     info.channelWidth = estimateChannelWidth(pBssDetail);
@@ -213,48 +217,14 @@ int WindowsWifiScanner::channelToFrequency(int channel) const {
 }
 
 bool WindowsWifiScanner::detectGuestNetwork(const std::string& ssid) const {
-    std::string lowerSSID = ssid;
-    std::transform(lowerSSID.begin(), lowerSSID.end(), lowerSSID.begin(), ::tolower);
-    
-    std::vector<std::string> guestPatterns = {
-        "guest", "visitor", "public", "hotel", "cafe", "restaurant",
-        "airport", "mall", "library", "university", "college",
-        "temporary", "temp", "test", "demo", "free", "open"
-    };
-    
-    for (const auto& pattern : guestPatterns) {
-        if (lowerSSID.find(pattern) != std::string::npos) {
-            return true;
-        }
-    }
-    
-    return false;
+    return SsidClassifier::instance().matches(ssid, SsidCategory::GUEST);
 }
 
 std::string WindowsWifiScanner::extractVendorFromBSSID(const std::string& bssid) const {
     if (bssid.length() < 17) return "";
     
-    // Extract OUI (first 6 characters)
-    std::string oui = bssid.substr(0, 8);
-    
-    // Common vendor OUIs
-    if (oui.substr(0, 8) == "00:1A:11" || oui.substr(0, 8) == "00:1A:11") {
-        return "Google";
-    } else if (oui.substr(0, 8) == "00:1B:63" || oui.substr(0, 8) == "00:1B:63") {
-        return "Apple";
-    } else if (oui.substr(0, 8) == "00:1C:C0" || oui.substr(0, 8) == "00:1C:C0") {
-        return "Cisco";
-    } else if (oui.substr(0, 8) == "00:1D:7E" || oui.substr(0, 8) == "00:1D:7E") {
-        return "Netgear";
-    } else if (oui.substr(0, 8) == "00:1E:40" || oui.substr(0, 8) == "00:1E:40") {
-        return "Asus";
-    } else if (oui.substr(0, 8) == "00:1F:3A" || oui.substr(0, 8) == "00:1F:3A") {
-        return "Dell";
-    } else if (oui.substr(0, 8) == "00:1F:3B" || oui.substr(0, 8) == "00:1F:3B") {
-        return "HP";
-    }
-    
-    return "Unknown";
+    const std::string_view vendor = OuiRegistry::instance().lookup(bssid);
+    return vendor.empty() ? "Unknown" : std::string(vendor);
 }
 
 int WindowsWifiScanner::estimateChannelWidth(const PWLAN_BSS_ENTRY pBssEntry) const {
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "NetworkInfo.h"
+#include "NetworkBatch.h"
+#include "VendorRegistry.h"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// Random scan results shared by the tests, and a field-by-field comparison
+
+namespace WifiScanner {
+
+// A network with every scoring input drawn at random. Half the frequencies are
+// real channels and band edges, half anywhere from 2300 to 7300 MHz. The BSSID
+// is unique per id and parses as a MAC address, in upper case for every third
+// id; the vendor is interned as a scanner would.
+inline NetworkInfo randomNetwork(std::mt19937& gen, size_t id) {
+    static const std::vector<int> frequencies = {0, 2412, 2437, 2484, 5180, 5745, 5885, 5955, 5999, 6000, 6415, 7115};
+    static const std::vector<std::string> vendors = {"", "Unknown", "Cisco", "Netgear", "Ubiquiti", "TP-Link", "Acme Radio"};
+    static const std::vector<std::string> capabilities = {"", "[WPA2-PSK-CCMP][ESS]", "[ESS]", "RSN SAE PMF"};
+    static const std::vector<std::string> radios = {"", "wlan0", "wlan0,wlan1"};
+    const char* hex = (id % 3 == 0) ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    NetworkInfo network;
+    network.ssid = "Net" + std::to_string(id % 700);
+    const uint64_t mac = (static_cast<uint64_t>(gen() & 0xFFFF) << 32) | (id & 0xFFFFFFFF);
+    for (int shift = 40; shift >= 0; shift -= 8) {
+        if (shift < 40) network.bssid += ':';
+        network.bssid += hex[(mac >> (shift + 4)) & 0xF];
+        network.bssid += hex[(mac >> shift) & 0xF];
+    }
+    network.securityType = static_cast<SecurityType>(gen() % 8);
+    network.frequency = (gen() % 2) ? frequencies[gen() % frequencies.size()] : 2300 + static_cast<int>(gen() % 5000);
+    network.channel = static_cast<int>(gen() % 200);
+    network.channelWidth = 20 << (gen() % 5);
+    network.signalStrength = -100 + static_cast<int>(gen() % 80);
+    network.maxDataRate = static_cast<int>(gen() % 2500);
+    network.beaconInterval = static_cast<int>(gen() % 1024);
+    network.capabilities = capabilities[gen() % capabilities.size()];
+    network.vendor = vendors[gen() % vendors.size()];
+    network.vendorId = VendorRegistry::instance().intern(network.vendor);
+    network.radios = radios[gen() % radios.size()];
+    unpackNetworkFlags(gen() & 0x7FF, network);
+    return network;
+}
+
+inline std::vector<NetworkInfo> randomNetworks(size_t count, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::vector<NetworkInfo> networks;
+    networks.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        networks.push_back(randomNetwork(gen, i));
+    }
+    return networks;
+}
+
+inline bool sameNetwork(const NetworkInfo& a, const NetworkInfo& b) {
+    return a.ssid == b.ssid && a.bssid == b.bssid && a.securityType == b.securityType &&
+           a.signalStrength == b.signalStrength && a.channel == b.channel && a.frequency == b.frequency &&
+           a.capabilities == b.capabilities && a.channelWidth == b.channelWidth &&
+           a.maxDataRate == b.maxDataRate && a.vendor == b.vendor && a.vendorId == b.vendorId &&
+           a.radios == b.radios && a.beaconInterval == b.beaconInterval && packNetworkFlags(a) == packNetworkFlags(b);
+}
+
+} // namespace WifiScanner
@@ -0,0 +1,304 @@
+#include "SecurityGrader.h"
+#include "NetworkBatch.h"
+#include "ComponentMatrix.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <stdexcept>
+#include <iostream>
+#include <cassert>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace WifiScanner;
+
+// Build networks that land on and around every threshold used by the scoring rules
+std::vector<NetworkInfo> generateBoundaryNetworks(size_t count, unsigned seed) {
+    std::mt19937 gen(seed);
+
+    const std::vector<int> frequencies = {0, 2399, 2400, 2412, 2484, 4999, 5000, 5180, 5924, 5925, 5955, 5999, 6000, 7115};
+    const std::vector<int> widths = {0, 10, 20, 30, 40, 60, 79, 80, 160, 320};
+    const std::vector<int> channels = {-1, 0, 1, 6, 11, 12, 14, 36, 165};
+    const std::vector<int> signals = {0, -29, -30, -31, -49, -50, -51, -69, -70, -71, -95};
+    const std::vector<int> rates = {0, 54, 99, 100, 300, 999, 1000, 2400};
+    const std::vector<int> beacons = {0, 25, 49, 50, 100, 200, 201, 1000};
+    const std::vector<std::string> vendors = {
+        "", "Unknown", "Cisco", "ARUBA", "Ruckus Wireless", "Ubiquiti", "Asus", "Netgear",
+        "TP-Link", "D-Link", "Linksys", "Google"
+    };
+
+    auto pick = [&gen](const auto& values) {
+        return values[std::uniform_int_distribution<size_t>(0, values.size() - 1)(gen)];
+    };
+
+    std::vector<NetworkInfo> networks;
+    networks.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        NetworkInfo network;
+        network.ssid = "Net" + std::to_string(i);
+        network.securityType = static_cast<SecurityType>(gen() % 8);
+        network.frequency = pick(frequencies);
+        network.channelWidth = pick(widths);
+        network.channel = pick(channels);
+        network.signalStrength = pick(signals);
+        network.maxDataRate = pick(rates);
+        network.beaconInterval = pick(beacons);
+        network.vendor = pick(vendors);
+
+        uint32_t bits = gen();
+        network.isHidden = bits & 1;
+        network.isEnterprise = bits & 2;
+        network.supportsWPS = bits & 4;
+        network.supportsPMF = bits & 8;
+        network.supportsOWE = bits & 16;
+        network.isGuestNetwork = bits & 32;
+        // Threat flags are rarer so that the -30 floor is hit but not saturated
+        network.isRogueAP = (bits & 0x300) == 0x300;
+        network.isEvilTwin = (bits & 0xC00) == 0xC00;
+        network.isTypoSquatting = (bits & 0x3000) == 0x3000;
+        network.respondsToProbes = bits & 0x4000;
+        network.hasAnomalousBehavior = (bits & 0x18000) == 0x18000;
+
+        networks.push_back(network);
+    }
+
+    return networks;
+}
+
+void assertBatchMatchesReference(const std::vector<NetworkInfo>& networks, SimdLevel level,
+                                 const std::string& testName) {
+    SecurityGrader grader;
+    NetworkBatch batch(networks);
+
+    std::vector<int> scores(networks.size(), -1);
+    std::vector<SecurityGrade> grades(networks.size(), SecurityGrade::VERY_BAD);
+    grader.gradeBatch(batch.view(), scores.data(), grades.data(), level);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < networks.size(); ++i) {
+        int expectedScore = grader.scoreNetwork(networks[i]);
+        SecurityGrade expectedGrade = grader.gradeNetwork(networks[i]);
+        if (scores[i] != expectedScore || grades[i] != expectedGrade) {
+            if (mismatches < 5) {
+                std::cout << "  row " << i << ": expected " << expectedScore
+                          << " got " << scores[i] << std::endl;
+            }
+            ++mismatches;
+        }
+    }
+
+    if (mismatches == 0) {
+        std::cout << "✓ " << testName << " - PASSED (" << networks.size() << " networks)" << std::endl;
+    } else {
+        std::cout << "✗ " << testName << " - FAILED (" << mismatches << " mismatches)" << std::endl;
+        assert(false);
+    }
+}
+
+void testBatchMatchesPerNetworkGrading() {
+    std::cout << "\n=== Testing Batch Scoring Against gradeNetwork ===" << std::endl;
+    std::cout << "Detected kernel: " << SecurityGrader::simdLevelToString(SecurityGrader::detectSimdLevel()) << std::endl;
+
+    auto networks = generateBoundaryNetworks(50000, 12345);
+
+    assertBatchMatchesReference(networks, SimdLevel::SCALAR, "Scalar batch kernel matches reference");
+    assertBatchMatchesReference(networks, SimdLevel::SSE42, "SSE4.2 batch kernel matches reference");
+    assertBatchMatchesReference(networks, SimdLevel::AVX2, "AVX2 batch kernel matches reference");
+}
+
+void testBatchRemainderRows() {
+    std::cout << "\n=== Testing Batch Remainder Handling ===" << std::endl;
+
+    // Sizes that are not multiples of the vector width exercise the scalar tail
+    for (size_t size : {0, 1, 3, 5, 7, 9, 13}) {
+        auto networks = generateBoundaryNetworks(size, static_cast<unsigned>(size) + 1);
+        assertBatchMatchesReference(networks, SecurityGrader::detectSimdLevel(),
+                                    "Batch of " + std::to_string(size) + " networks");
+    }
+}
+
+void testBatchOptionalOutputs() {
+    std::cout << "\n=== Testing Batch Optional Outputs ===" << std::endl;
+
+    auto networks = generateBoundaryNetworks(37, 99);
+    NetworkBatch batch(networks);
+    SecurityGrader grader;
+
+    std::vector<SecurityGrade> gradesOnly(networks.size());
+    grader.gradeBatch(batch.view(), nullptr, gradesOnly.data());
+
+    std::vector<int> scoresOnly(networks.size());
+    grader.gradeBatch(batch.view(), scoresOnly.data(), nullptr);
+
+    bool ok = true;
+    for (size_t i = 0; i < networks.size(); ++i) {
+        ok = ok && gradesOnly[i] == grader.gradeNetwork(networks[i]);
+        ok = ok && scoresOnly[i] == grader.scoreNetwork(networks[i]);
+    }
+
+    if (ok) {
+        std::cout << "✓ Scores and grades can be requested independently - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Scores and grades can be requested independently - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testThreadPool() {
+    std::cout << "\n=== Testing Thread Pool ===" << std::endl;
+    
+    // A private pool so worker threads are exercised even on single-core machines
+    ThreadPool pool(3);
+    
+    bool ok = true;
+    for (size_t round = 0; round < 50; ++round) {
+        std::vector<std::atomic<int>> visits(100);
+        pool.parallelFor(visits.size(), [&](size_t i) { visits[i].fetch_add(1); });
+        for (const auto& count : visits) {
+            ok = ok && count.load() == 1;
+        }
+    }
+    
+    bool rethrown = false;
+    try {
+        pool.parallelFor(16, [](size_t i) {
+            if (i == 7) {
+                throw std::runtime_error("task failed");
+            }
+        });
+    } catch (const std::runtime_error&) {
+        rethrown = true;
+    }
+    
+    if (ok && rethrown) {
+        std::cout << "✓ Every task runs exactly once and errors reach the caller - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Every task runs exactly once and errors reach the caller - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testParallelSortingMatchesSequential() {
+    std::cout << "\n=== Testing Parallel Grading and Sorting ===" << std::endl;
+    
+    // Distinct BSSIDs make every position in the result checkable
+    auto networks = generateBoundaryNetworks(50000, 4242);
+    for (size_t i = 0; i < networks.size(); ++i) {
+        networks[i].bssid = std::to_string(i);
+    }
+    
+    SecurityGrader grader;
+    auto expected = grader.gradeAndSortNetworks(networks);
+    
+    for (size_t threads : {0, 2, 3, 4, 8, 64}) {
+        auto sorted = grader.gradeAndSortNetworks(networks, ExecutionPolicy::parallel(threads));
+        bool ok = sorted.size() == expected.size();
+        for (size_t i = 0; ok && i < sorted.size(); ++i) {
+            ok = sorted[i].bssid == expected[i].bssid;
+        }
+        
+        std::string testName = "Parallel sort with " + (threads == 0 ? std::string("all") : std::to_string(threads)) +
+                               " threads matches sequential order";
+        if (ok) {
+            std::cout << "✓ " << testName << " - PASSED" << std::endl;
+        } else {
+            std::cout << "✗ " << testName << " - FAILED" << std::endl;
+            assert(false);
+        }
+    }
+    
+    bool emptyOk = grader.gradeAndSortNetworks(std::vector<NetworkInfo>{}, ExecutionPolicy::parallel()).empty();
+    if (emptyOk) {
+        std::cout << "✓ Parallel sort of an empty scan - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Parallel sort of an empty scan - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testProfileMatrixMatchesPerProfileGrading() {
+    std::cout << "\n=== Testing Multi-Profile Scoring ===" << std::endl;
+    
+    auto networks = generateBoundaryNetworks(20003, 99);
+    SecurityGrader grader;
+    ComponentMatrix matrix(grader, networks);
+    
+    // Candidate weight sets around the defaults, including extreme ones
+    std::mt19937 gen(5);
+    std::vector<WeightProfile> profiles(12);
+    for (size_t p = 0; p < profiles.size(); ++p) {
+        WeightProfile& profile = profiles[p];
+        profile.name = "candidate-" + std::to_string(p);
+        for (double* weight : {&profile.encryption, &profile.authentication, &profile.channel, &profile.feature,
+                               &profile.configuration, &profile.vendor, &profile.advanced}) {
+            *weight = static_cast<double>(gen() % 6000) / 10000.0;
+        }
+        profile.excellent = 60 + static_cast<int>(gen() % 30);
+        profile.good = profile.excellent - static_cast<int>(gen() % 15);
+        profile.okay = profile.good - static_cast<int>(gen() % 15);
+        profile.bad = profile.okay - static_cast<int>(gen() % 15);
+    }
+    profiles[0].encryption = 10.0;  // Saturates at 100
+    profiles[1].advanced = 10.0;    // Negative totals clamp at 0
+    
+    // Reference: grade the corpus once per profile
+    std::vector<ProfileHistogram> expected(profiles.size());
+    for (size_t p = 0; p < profiles.size(); ++p) {
+        grader.setProfile(std::make_shared<ProfileEvaluator>(profiles[p]));
+        for (const auto& network : networks) {
+            ++expected[p].grades[static_cast<size_t>(grader.gradeNetwork(network))];
+            expected[p].scoreSum += grader.scoreNetwork(network);
+        }
+    }
+    
+    for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::AVX2}) {
+        for (size_t threads : {1, 3}) {
+            auto histograms = matrix.scoreProfiles(profiles, ExecutionPolicy::parallel(threads), level);
+            bool ok = histograms.size() == profiles.size();
+            for (size_t p = 0; ok && p < profiles.size(); ++p) {
+                ok = histograms[p].profile == profiles[p].name && histograms[p].networks == networks.size() &&
+                     histograms[p].grades == expected[p].grades && histograms[p].scoreSum == expected[p].scoreSum;
+            }
+            
+            std::string testName = SecurityGrader::simdLevelToString(level) + " histograms on " +
+                                   std::to_string(threads) + " thread(s) match per-profile grading";
+            if (ok) {
+                std::cout << "✓ " << testName << " - PASSED" << std::endl;
+            } else {
+                std::cout << "✗ " << testName << " - FAILED" << std::endl;
+                assert(false);
+            }
+        }
+    }
+    
+    auto empty = ComponentMatrix().scoreProfiles(profiles);
+    if (empty.size() == profiles.size() && empty[0].networks == 0 && empty[0].meanScore() == 0.0) {
+        std::cout << "✓ Empty corpus yields empty histograms - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Empty corpus yields empty histograms - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+int main() {
+    std::cout << "Starting Batch Scoring Tests..." << std::endl;
+
+    try {
+        testBatchMatchesPerNetworkGrading();
+        testBatchRemainderRows();
+        testBatchOptionalOutputs();
+        testThreadPool();
+        testParallelSortingMatchesSequential();
+        testProfileMatrixMatchesPerProfileGrading();
+
+        std::cout << "\n🎉 All tests passed! Batch scoring matches per-network grading." << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,190 @@
+#include "CompactNetwork.h"
+#include "SecurityGrader.h"
+#include "TestNetworks.h"
+#include "VendorRegistry.h"
+#include "WeightProfile.h"
+#include <iostream>
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace WifiScanner;
+
+// Random networks without radios, which have no compact field
+std::vector<NetworkInfo> representableNetworks(size_t count, unsigned seed) {
+    std::vector<NetworkInfo> networks = randomNetworks(count, seed);
+    for (auto& network : networks) {
+        network.radios.clear();
+    }
+    return networks;
+}
+
+void testLayout() {
+    CompactNetwork compact;
+    if (sizeof(CompactNetwork) == 56 && compact.channelWidth == 20 && compact.beaconInterval == 100 &&
+        compact.ssidLength == 0 && compact.bssidString().empty()) {
+        std::cout << "✓ CompactNetwork is 56 bytes with NetworkInfo defaults - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ CompactNetwork is 56 bytes with NetworkInfo defaults - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testRoundTrip() {
+    std::vector<NetworkInfo> networks = representableNetworks(2000, 12);
+
+    // Edge cases: empty and full-length SSIDs with embedded NULs, no BSSID, defaults
+    NetworkInfo edge;
+    edge.securityType = SecurityType::OPEN;
+    networks.push_back(edge);
+    edge.ssid = std::string("\0ab\0", 4) + std::string(28, 'x');
+    edge.bssid = "FF:FF:FF:FF:FF:FF";
+    edge.signalStrength = -128;
+    edge.frequency = 65535;
+    networks.push_back(edge);
+
+    size_t mismatches = 0;
+    for (const auto& network : networks) {
+        NetworkInfo restored = CompactNetwork::fromNetworkInfo(network).toNetworkInfo();
+        if (!sameNetwork(network, restored) ||
+            restored.vendorId != VendorRegistry::instance().intern(network.vendor)) {
+            ++mismatches;
+        }
+    }
+
+    if (mismatches == 0) {
+        std::cout << "✓ NetworkInfo survives a compact round trip - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ NetworkInfo survives a compact round trip - FAILED (" << mismatches
+                  << " mismatches)" << std::endl;
+        assert(false);
+    }
+}
+
+void testRejectsUnrepresentable() {
+    std::vector<NetworkInfo> rejected;
+    NetworkInfo network;
+    network.securityType = SecurityType::WPA2_PERSONAL;
+    network.bssid = "aa:bb:cc:dd:ee:ff";
+
+    NetworkInfo longSsid = network;
+    longSsid.ssid = std::string(33, 'x');
+    rejected.push_back(longSsid);
+
+    for (const char* bssid : {"aa:bb:cc:dd:ee", "aa:bb:cc:dd:ee:fg", "aa-bb-cc-dd-ee-ff", "aA:bb:cc:dd:ee:ff", "Unknown"}) {
+        NetworkInfo badBssid = network;
+        badBssid.bssid = bssid;
+        rejected.push_back(badBssid);
+    }
+
+    NetworkInfo loud = network;
+    loud.signalStrength = 200;
+    rejected.push_back(loud);
+
+    NetworkInfo farFrequency = network;
+    farFrequency.frequency = 70000;
+    rejected.push_back(farFrequency);
+
+    NetworkInfo negativeRate = network;
+    negativeRate.maxDataRate = -1;
+    rejected.push_back(negativeRate);
+
+    NetworkInfo seenByRadios = network;
+    seenByRadios.radios = "wlan0,wlan1";
+    rejected.push_back(seenByRadios);
+
+    size_t accepted = 0;
+    size_t thrown = 0;
+    for (const auto& bad : rejected) {
+        CompactNetwork compact;
+        accepted += CompactNetwork::tryFromNetworkInfo(bad, compact);
+        try {
+            CompactNetwork::fromNetworkInfo(bad);
+        } catch (const std::invalid_argument&) {
+            ++thrown;
+        }
+    }
+
+    if (accepted == 0 && thrown == rejected.size()) {
+        std::cout << "✓ Unrepresentable networks are rejected - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Unrepresentable networks are rejected - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+bool gradesMatch(const SecurityGrader& grader, const std::vector<NetworkInfo>& networks,
+                 const std::vector<CompactNetwork>& compact) {
+    for (size_t i = 0; i < networks.size(); ++i) {
+        ScoreBreakdown expected = grader.scoreBreakdown(networks[i]);
+        ScoreBreakdown actual = grader.scoreBreakdown(compact[i]);
+        if (grader.scoreNetwork(networks[i]) != grader.scoreNetwork(compact[i]) ||
+            grader.gradeNetwork(networks[i]) != grader.gradeNetwork(compact[i]) ||
+            expected.score != actual.score || expected.grade != actual.grade ||
+            expected.encryption != actual.encryption || expected.channel != actual.channel ||
+            expected.configuration != actual.configuration || expected.vendor != actual.vendor ||
+            expected.advanced != actual.advanced) {
+            return false;
+        }
+    }
+
+    auto expected = grader.gradeAndSortNetworks(networks);
+    auto actual = grader.gradeAndSortNetworks(compact);
+    if (expected.size() != actual.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (!sameNetwork(expected[i], actual[i].toNetworkInfo())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testGradingMatchesNetworkInfo() {
+    const std::vector<NetworkInfo> networks = representableNetworks(3000, 34);
+    std::vector<CompactNetwork> compact;
+    for (const auto& network : networks) {
+        compact.push_back(CompactNetwork::fromNetworkInfo(network));
+    }
+
+    SecurityGrader grader;
+    bool builtIn = gradesMatch(grader, networks, compact);
+
+    WeightProfile strict;
+    strict.name = "strict";
+    strict.encryption = 0.5;
+    strict.vendor = 0.0;
+    strict.excellent = 80;
+    grader.setProfile(std::make_shared<ProfileEvaluator>(strict));
+    bool profiled = gradesMatch(grader, networks, compact);
+
+    if (builtIn && profiled) {
+        std::cout << "✓ Compact networks grade and sort like NetworkInfo - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Compact networks grade and sort like NetworkInfo - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+int main() {
+    std::cout << "Starting Compact Network Tests..." << std::endl;
+
+    try {
+        testLayout();
+        testRoundTrip();
+        testRejectsUnrepresentable();
+        testGradingMatchesNetworkInfo();
+
+        std::cout << "\n🎉 All tests passed! Compact networks are lossless and grade identically." << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
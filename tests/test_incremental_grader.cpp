@@ -0,0 +1,316 @@
+#include "IncrementalGrader.h"
+#include "NetworkTable.h"
+#include "SecurityGrader.h"
+#include "TestNetworks.h"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace WifiScanner;
+
+// Ranking keys without the position field, in result order
+std::vector<uint32_t> rankingSequence(const SecurityGrader& grader, const std::vector<NetworkInfo>& networks) {
+    std::vector<uint32_t> sequence;
+    for (const auto& network : networks) {
+        uint64_t key = SecurityGrader::makeRankingKey(grader.scoreNetwork(network), packNetworkFlags(network), 0);
+        sequence.push_back(static_cast<uint32_t>(key >> 32));
+    }
+    return sequence;
+}
+
+void assertMatchesFullSort(const SecurityGrader& grader, const IncrementalGrader& incremental,
+                           const std::vector<NetworkInfo>& scan, const std::string& testName) {
+    auto expected = grader.gradeAndSortNetworks(scan);
+    auto actual = incremental.sortedNetworks(scan);
+
+    // Same networks, same ranking; only exact ties may be ordered differently
+    std::multiset<std::string> expectedBssids, actualBssids;
+    for (const auto& network : expected) expectedBssids.insert(network.bssid + network.ssid);
+    for (const auto& network : actual) actualBssids.insert(network.bssid + network.ssid);
+
+    bool ok = expectedBssids == actualBssids &&
+              rankingSequence(grader, expected) == rankingSequence(grader, actual);
+    
+    // Stored breakdowns line up with the sorted networks
+    auto breakdowns = incremental.sortedBreakdowns();
+    ok = ok && breakdowns.size() == actual.size();
+    for (size_t i = 0; ok && i < actual.size(); ++i) {
+        ScoreBreakdown fresh = grader.scoreBreakdown(actual[i]);
+        ok = breakdowns[i].score == fresh.score && breakdowns[i].grade == fresh.grade &&
+             breakdowns[i].configuration == fresh.configuration;
+    }
+
+    if (ok) {
+        std::cout << "✓ " << testName << " - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ " << testName << " - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testFirstScanMatchesFullSort() {
+    std::cout << "\n=== Testing First Scan ===" << std::endl;
+
+    std::mt19937 gen(7);
+    std::vector<NetworkInfo> scan;
+    for (size_t i = 0; i < 1000; ++i) {
+        scan.push_back(randomNetwork(gen, i));
+    }
+
+    SecurityGrader grader;
+    IncrementalGrader incremental(grader);
+    IncrementalUpdateStats stats = incremental.update(scan);
+
+    // With no history, first-seen order is scan order, so the result is exact
+    auto expected = grader.gradeAndSortNetworks(scan);
+    auto actual = incremental.sortedNetworks(scan);
+    bool ok = stats.added == scan.size() && stats.rebuilt && actual.size() == expected.size();
+    for (size_t i = 0; ok && i < actual.size(); ++i) {
+        ok = actual[i].bssid == expected[i].bssid;
+    }
+
+    if (ok) {
+        std::cout << "✓ First scan should match gradeAndSortNetworks exactly - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ First scan should match gradeAndSortNetworks exactly - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testContinuousMonitoring() {
+    std::cout << "\n=== Testing Continuous Monitoring ===" << std::endl;
+
+    std::mt19937 gen(99);
+    std::vector<NetworkInfo> scan;
+    size_t nextId = 0;
+    for (; nextId < 2000; ++nextId) {
+        scan.push_back(randomNetwork(gen, nextId));
+    }
+
+    SecurityGrader grader;
+    IncrementalGrader incremental(grader);
+    incremental.update(scan);
+
+    bool statsOk = true;
+    for (int round = 0; round < 20; ++round) {
+        // ~3% drift, ~1% churn, and the scanner reports in a different order
+        size_t expectedChanged = 0;
+        for (auto& network : scan) {
+            if (gen() % 100 < 3) {
+                network.signalStrength = -30 - static_cast<int>(gen() % 60);
+                network.supportsPMF = !network.supportsPMF;
+                ++expectedChanged;
+            } else if (gen() % 50 == 0) {
+                network.ssid += "-renamed";  // Display-only change, no regrade
+            }
+        }
+        for (int i = 0; i < 20; ++i) {
+            scan.erase(scan.begin() + gen() % scan.size());
+        }
+        for (int i = 0; i < 20; ++i) {
+            scan.push_back(randomNetwork(gen, nextId++));
+        }
+        std::shuffle(scan.begin(), scan.end(), gen);
+
+        IncrementalUpdateStats stats = incremental.update(scan);
+        statsOk = statsOk && !stats.rebuilt && stats.added == 20 && stats.removed == 20 &&
+                  stats.changed <= expectedChanged &&
+                  stats.added + stats.changed + stats.unchanged == scan.size();
+
+        assertMatchesFullSort(grader, incremental, scan, "Round " + std::to_string(round + 1) + " matches a full regrade");
+    }
+
+    if (statsOk) {
+        std::cout << "✓ Only new and changed BSSIDs are regraded - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Only new and changed BSSIDs are regraded - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testLargeChangeRebuilds() {
+    std::cout << "\n=== Testing Rebuild on Large Changes ===" << std::endl;
+
+    std::mt19937 gen(3);
+    std::vector<NetworkInfo> scan;
+    for (size_t i = 0; i < 400; ++i) {
+        scan.push_back(randomNetwork(gen, i));
+    }
+
+    SecurityGrader grader;
+    IncrementalGrader incremental(grader);
+    incremental.update(scan);
+
+    for (auto& network : scan) {
+        network.signalStrength -= 7;
+    }
+    IncrementalUpdateStats stats = incremental.update(scan);
+
+    if (stats.rebuilt) {
+        std::cout << "✓ Mostly-dirty scans fall back to a full sort - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Mostly-dirty scans fall back to a full sort - FAILED" << std::endl;
+        assert(false);
+    }
+    assertMatchesFullSort(grader, incremental, scan, "Rebuilt order matches a full regrade");
+
+    incremental.update(std::vector<NetworkInfo>());
+    if (incremental.size() == 0 && incremental.sortedNetworks({}).empty()) {
+        std::cout << "✓ Empty scan removes every entry - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Empty scan removes every entry - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testDuplicateBssids() {
+    std::cout << "\n=== Testing Duplicate BSSIDs ===" << std::endl;
+
+    std::mt19937 gen(11);
+    NetworkInfo first = randomNetwork(gen, 1);
+    NetworkInfo second = randomNetwork(gen, 2);
+    second.bssid = first.bssid;
+    second.ssid = "SecondRadio";
+
+    SecurityGrader grader;
+    IncrementalGrader incremental(grader);
+    incremental.update({first, second});
+    IncrementalUpdateStats stats = incremental.update({first, second});
+
+    if (incremental.size() == 2 && stats.unchanged == 2) {
+        std::cout << "✓ Repeated BSSIDs in one scan are kept apart - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Repeated BSSIDs in one scan are kept apart - FAILED" << std::endl;
+        assert(false);
+    }
+    assertMatchesFullSort(grader, incremental, {first, second}, "Repeated BSSIDs match a full regrade");
+}
+
+void testTiesKeepFirstSeenOrder() {
+    std::cout << "\n=== Testing First-Seen Order of Ties ===" << std::endl;
+
+    // Identical scoring inputs, so only the tie-break orders them
+    auto tiedNetwork = [](size_t id) {
+        NetworkInfo network;
+        network.ssid = "Tied";
+        network.bssid = "02:00:00:" + std::to_string(id);
+        network.securityType = SecurityType::WPA2_PERSONAL;
+        network.frequency = 5180;
+        return network;
+    };
+
+    SecurityGrader grader;
+    IncrementalGrader incremental(grader);
+    std::vector<NetworkInfo> scan;
+    std::vector<std::string> firstSeen;
+    size_t nextId = 0;
+    for (; nextId < 40; ++nextId) {
+        scan.push_back(tiedNetwork(nextId));
+        firstSeen.push_back(scan.back().bssid);
+    }
+    incremental.update(scan);
+
+    std::mt19937 gen(5);
+    bool ok = true;
+    for (int round = 0; round < 200 && ok; ++round) {
+        // Drop two, add one new BSSID, and report in a new order; removed slots
+        // must not let the newcomer jump ahead of older networks
+        for (int i = 0; i < 2 && scan.size() > 10; ++i) {
+            const size_t victim = gen() % scan.size();
+            firstSeen.erase(std::find(firstSeen.begin(), firstSeen.end(), scan[victim].bssid));
+            scan.erase(scan.begin() + victim);
+        }
+        scan.push_back(tiedNetwork(nextId++));
+        firstSeen.push_back(scan.back().bssid);
+        std::shuffle(scan.begin(), scan.end(), gen);
+        incremental.update(scan);
+
+        std::vector<std::string> order;
+        for (const auto& network : incremental.sortedNetworks(scan)) {
+            order.push_back(network.bssid);
+        }
+        ok = order == firstSeen;
+    }
+
+    if (ok) {
+        std::cout << "✓ Tied networks stay in first-seen order through churn - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Tied networks stay in first-seen order through churn - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testTableScansMatchVectorScans() {
+    std::cout << "\n=== Testing Table Scans ===" << std::endl;
+
+    std::mt19937 gen(23);
+    std::vector<NetworkInfo> scan;
+    size_t nextId = 0;
+    for (; nextId < 1500; ++nextId) {
+        scan.push_back(randomNetwork(gen, nextId));
+    }
+
+    SecurityGrader grader;
+    IncrementalGrader fromVector(grader);
+    IncrementalGrader fromTable(grader);
+    bool ok = true;
+    for (int round = 0; ok && round < 5; ++round) {
+        for (auto& network : scan) {
+            if (gen() % 100 < 5) {
+                network.signalStrength = -30 - static_cast<int>(gen() % 60);
+            }
+        }
+        scan.push_back(randomNetwork(gen, nextId++));
+        std::shuffle(scan.begin(), scan.end(), gen);
+
+        const NetworkTable table(scan);
+        const IncrementalUpdateStats vectorStats = fromVector.update(scan);
+        const IncrementalUpdateStats tableStats = fromTable.update(table);
+
+        // Same bookkeeping, same order, same breakdowns
+        const auto sorted = fromVector.sortedNetworks(scan);
+        const NetworkTable sortedTable = table.select(fromTable.sortedRows());
+        const auto vectorBreakdowns = fromVector.sortedBreakdowns();
+        const auto tableBreakdowns = fromTable.sortedBreakdowns();
+        ok = vectorStats.added == tableStats.added && vectorStats.changed == tableStats.changed &&
+             vectorStats.unchanged == tableStats.unchanged && sortedTable.size() == sorted.size();
+        for (size_t i = 0; ok && i < sorted.size(); ++i) {
+            ok = sortedTable[i].bssid() == sorted[i].bssid && tableBreakdowns[i].score == vectorBreakdowns[i].score &&
+                 tableBreakdowns[i].configuration == vectorBreakdowns[i].configuration &&
+                 ScoreCache::fingerprint(table[i]) == ScoreCache::fingerprint(scan[i]);
+        }
+    }
+
+    if (ok) {
+        std::cout << "✓ Table scans grade and sort like vector scans - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Table scans grade and sort like vector scans - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+int main() {
+    std::cout << "Starting Incremental Grader Tests..." << std::endl;
+
+    try {
+        testFirstScanMatchesFullSort();
+        testContinuousMonitoring();
+        testLargeChangeRebuilds();
+        testDuplicateBssids();
+        testTiesKeepFirstSeenOrder();
+        testTableScansMatchVectorScans();
+
+        std::cout << "\n🎉 All tests passed! Incremental grading matches full regrading." << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
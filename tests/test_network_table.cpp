@@ -0,0 +1,165 @@
+#include "NetworkTable.h"
+#include "ScanArena.h"
+#include "SecurityGrader.h"
+#include "TestNetworks.h"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <vector>
+
+using namespace WifiScanner;
+
+void testRowsAndColumns() {
+    auto networks = randomNetworks(1500, 3);
+    NetworkTable table(networks);
+
+    // Bulk and single appends produce the same rows
+    NetworkTable appended;
+    appended.append(randomNetworks(1000, 3));
+    appended.append(randomNetworks(1500, 3)[1000]);
+
+    bool ok = table.size() == networks.size() && table.ssids().size() == networks.size() &&
+              table.view().size == networks.size();
+    for (size_t i = 0; ok && i < networks.size(); ++i) {
+        ok = sameNetwork(table[i].toNetworkInfo(), networks[i]) &&
+             table.frequencies()[i] == networks[i].frequency && std::string_view(table.vendors()[i]) == networks[i].vendor &&
+             table.flags()[i] == packNetworkFlags(networks[i]) && table[i].has(FLAG_HIDDEN) == networks[i].isHidden;
+    }
+    for (size_t i = 0; ok && i < appended.size(); ++i) {
+        ok = sameNetwork(appended[i].toNetworkInfo(), networks[i]);
+    }
+
+    // select() gathers rows in the requested order
+    NetworkTable picked = table.select({7, 3, 3, 1200});
+    ok = ok && picked.size() == 4 && sameNetwork(picked[0].toNetworkInfo(), networks[7]) &&
+         sameNetwork(picked[2].toNetworkInfo(), networks[3]) && sameNetwork(picked[3].toNetworkInfo(), networks[1200]);
+
+    if (ok && appended.size() == 1001) {
+        std::cout << "✓ NetworkTable rows and columns match the source networks - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ NetworkTable rows and columns match the source networks - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testAnalyticPasses() {
+    auto networks = randomNetworks(4000, 5);
+    NetworkTable table(networks);
+
+    std::vector<uint32_t> expected5GHz;
+    std::array<size_t, 8> expectedTypes{};
+    int minSignal = 0, maxSignal = -1000;
+    double sum = 0;
+    for (size_t i = 0; i < networks.size(); ++i) {
+        const int frequency = networks[i].frequency;
+        if (frequency >= 5000 && frequency < 5925) {
+            expected5GHz.push_back(static_cast<uint32_t>(i));
+        }
+        ++expectedTypes[static_cast<size_t>(networks[i].securityType)];
+        minSignal = std::min(minSignal, networks[i].signalStrength);
+        maxSignal = std::max(maxSignal, networks[i].signalStrength);
+        sum += networks[i].signalStrength;
+    }
+
+    size_t allBands = 0;
+    for (WifiBand band : {WifiBand::OTHER, WifiBand::BAND_2_4GHZ, WifiBand::BAND_5GHZ, WifiBand::BAND_6GHZ}) {
+        allBands += table.rowsInBand(band).size();
+    }
+    const SignalStats stats = table.signalStats();
+    const SignalStats empty = NetworkTable().signalStats();
+
+    if (table.rowsInBand(WifiBand::BAND_5GHZ) == expected5GHz && allBands == networks.size() &&
+        table.countBySecurityType() == expectedTypes && stats.count == networks.size() &&
+        stats.min == minSignal && stats.max == maxSignal && std::abs(stats.mean - sum / networks.size()) < 1e-9 &&
+        empty.count == 0 && NetworkTable::bandOf(5955) == WifiBand::BAND_6GHZ) {
+        std::cout << "✓ Band filter, security counts and signal statistics - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Band filter, security counts and signal statistics - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testGradingFromColumns() {
+    auto networks = randomNetworks(3 * SecurityGrader::MIN_PARALLEL_CHUNK + 17, 9);
+    NetworkTable table(networks);
+    SecurityGrader grader;
+
+    // The table's view scores exactly like a NetworkBatch
+    std::vector<int> tableScores(networks.size()), batchScores(networks.size());
+    grader.gradeBatch(table.view(), tableScores.data(), nullptr);
+    grader.gradeBatch(NetworkBatch(networks).view(), batchScores.data(), nullptr);
+
+    bool ok = tableScores == batchScores;
+    for (ExecutionPolicy policy : {ExecutionPolicy::sequential(), ExecutionPolicy::parallel(4)}) {
+        auto expected = grader.gradeAndSortNetworks(networks, policy);
+        NetworkTable sorted = grader.gradeAndSortNetworks(table, policy);
+        ok = ok && sorted.size() == expected.size();
+        for (size_t i = 0; ok && i < expected.size(); ++i) {
+            ok = sameNetwork(sorted[i].toNetworkInfo(), expected[i]);
+        }
+    }
+
+    if (ok) {
+        std::cout << "✓ SecurityGrader ranks a NetworkTable like the vector form - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ SecurityGrader ranks a NetworkTable like the vector form - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testArenaBackedSweeps() {
+    SecurityGrader grader;
+    ScanBuffer buffer(4096);  // Deliberately too small for the first sweep
+    bool ok = buffer.table().empty();
+
+    std::vector<size_t> heapAllocations;
+    for (unsigned sweep = 0; sweep < 4; ++sweep) {
+        auto networks = randomNetworks(2000, 20 + sweep);
+        NetworkTable& table = buffer.begin();
+        for (const auto& network : networks) {
+            table.append(network);
+        }
+        heapAllocations.push_back(buffer.arena().heapAllocations());
+
+        ok = ok && table.resource() == &buffer.arena() && table.size() == networks.size() &&
+             grader.rankNetworks(table) == grader.rankNetworks(NetworkTable(networks));
+        for (size_t i = 0; ok && i < networks.size(); ++i) {
+            ok = sameNetwork(table[i].toNetworkInfo(), networks[i]);
+        }
+
+        // Copies leave the arena; select() stays on it
+        NetworkTable copy = table;
+        ok = ok && copy.resource() == std::pmr::get_default_resource() &&
+             table.select({0, 1}).resource() == &buffer.arena() && sameNetwork(copy[5].toNetworkInfo(), networks[5]);
+    }
+
+    // The first sweep overflows to the heap; the arena then grows and later sweeps stay inside it
+    if (ok && heapAllocations[0] > 0 && heapAllocations[1] == 0 && heapAllocations[2] == 0 &&
+        heapAllocations[3] == 0 && buffer.arena().capacity() > 4096) {
+        std::cout << "✓ Arena-backed sweeps stop allocating after the first - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Arena-backed sweeps stop allocating after the first - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+int main() {
+    std::cout << "Starting Network Table Tests..." << std::endl;
+
+    try {
+        testRowsAndColumns();
+        testAnalyticPasses();
+        testGradingFromColumns();
+        testArenaBackedSweeps();
+
+        std::cout << "\n🎉 All tests passed! NetworkTable matches the row-wise results." << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,176 @@
+#include "OuiRegistry.h"
+#include "VendorRegistry.h"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+using namespace WifiScanner;
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("wifi_oui_test_" + name)).string();
+}
+
+void writeFile(const std::string& path, const std::string& contents) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << contents;
+}
+
+bool rejects(const std::string& path) {
+    try {
+        OuiRegistry registry(path);
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+void testBuiltinTable() {
+    OuiRegistry registry;
+    uint32_t oui = 0;
+
+    bool ok = registry.size() > 150 &&
+              registry.lookup("00:1C:C0:12:34:56") == "Cisco" &&
+              registry.lookup("00-0b-86-aa-bb-cc") == "Aruba" &&
+              registry.lookup("001A11FFEEDD") == "Google" &&
+              registry.lookup("FC:EC:DA:01:02:03") == "Ubiquiti" &&
+              registry.lookup(0x001D7E) == "Netgear" &&
+              registry.lookup("12:34:56:78:9A:BC").empty() &&   // Locally administered
+              registry.lookup("7C:00:00:00:00:01").empty() &&
+              registry.lookup("00:1C").empty() &&
+              OuiRegistry::parseOui("a4:77:33:00:00:00", oui) && oui == 0xA47733 &&
+              !OuiRegistry::parseOui("0:1C:C0", oui) && !OuiRegistry::parseOui("00:1G:C0", oui);
+
+    // The names are the ones the grader rates
+    const uint16_t aruba = VendorRegistry::instance().intern(std::string(registry.lookup("00:0B:86:00:00:01")));
+    ok = ok && VendorRegistry::instance().score(aruba) > 0;
+
+    if (ok) {
+        std::cout << "✓ Built-in table resolves common AP vendors - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Built-in table resolves common AP vendors - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testRegistryFormats() {
+    const std::string ieee = tempPath("oui.txt");
+    const std::string csv = tempPath("oui.csv");
+    const std::string manuf = tempPath("manuf");
+
+    writeFile(ieee,
+              "OUI/MA-L                                                    Organization\n"
+              "company_id                                                  Organization\n"
+              "\n"
+              "00-00-0C   (hex)\t\tCisco Systems, Inc\r\n"
+              "00000C     (base 16)\t\tCisco Systems, Inc\r\n"
+              "\t\t\t\t170 WEST TASMAN DRIVE\r\n"
+              "\n"
+              "28-6E-D4   (hex)\t\tHUAWEI TECHNOLOGIES CO.,LTD\n"
+              "00-00-0C   (hex)\t\tDuplicate Listing\n");
+    writeFile(csv,
+              "Registry,Assignment,Organization Name,Organization Address\n"
+              "MA-L,000B86,\"Aruba, a Hewlett Packard Enterprise Company\",\"3333 Scott Blvd Santa Clara CA US 95054\"\n"
+              "MA-L,F4F26D,TP-LINK TECHNOLOGIES CO.,LTD.,Building 24 Shenzhen CN\n");
+    writeFile(manuf,
+              "# Wireshark manufacturer database\n"
+              "00:00:01\tXerox\tXerox Corporation\n"
+              "00:1B:C5:00:00:00/36\tConverging\tConverging Systems Inc.\n"
+              "00:04:5A\tLinksys  # Cisco-Linksys\n");
+
+    OuiRegistry fromIeee(ieee);
+    OuiRegistry fromCsv(csv);
+    OuiRegistry fromManuf(manuf);
+
+    bool ok = fromIeee.size() == 2 && fromIeee.lookup(0x00000C) == "Cisco Systems, Inc" &&
+              fromIeee.lookup(0x286ED4) == "HUAWEI TECHNOLOGIES CO.,LTD" &&
+              fromCsv.size() == 2 && fromCsv.lookup(0x000B86) == "Aruba, a Hewlett Packard Enterprise Company" &&
+              fromCsv.lookup(0xF4F26D) == "TP-LINK TECHNOLOGIES CO." &&
+              fromManuf.size() == 2 && fromManuf.lookup(0x000001) == "Xerox Corporation" &&
+              fromManuf.lookup(0x00045A) == "Linksys" && fromManuf.lookup(0x001BC5).empty();
+
+    std::remove(ieee.c_str());
+    std::remove(csv.c_str());
+    std::remove(manuf.c_str());
+
+    if (ok) {
+        std::cout << "✓ IEEE text, IEEE CSV and Wireshark manuf registries load - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ IEEE text, IEEE CSV and Wireshark manuf registries load - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testCompiledDatabase() {
+    const std::string text = tempPath("full.txt");
+    const std::string database = tempPath("full.db");
+    const std::string damaged = tempPath("damaged.db");
+
+    // A registry the size of the IEEE MA-L list
+    std::mt19937 gen(5);
+    std::unordered_map<uint32_t, std::string> expected;
+    std::string contents;
+    while (expected.size() < 35000) {
+        const uint32_t oui = gen() & 0xFCFFFF;  // Universally administered, unicast
+        const std::string name = "Vendor " + std::to_string(gen() % 20000);
+        if (expected.emplace(oui, name).second) {
+            char prefix[16];
+            std::snprintf(prefix, sizeof(prefix), "%02X-%02X-%02X", oui >> 16, oui >> 8 & 0xFF, oui & 0xFF);
+            contents += std::string(prefix) + "   (hex)\t\t" + name + "\n";
+        }
+    }
+    writeFile(text, contents);
+    OuiRegistry::compile(text, database);
+    OuiRegistry compiled(database);
+
+    bool ok = compiled.size() == expected.size();
+    for (const auto& entry : expected) {
+        ok = ok && compiled.lookup(entry.first) == entry.second;
+    }
+    ok = ok && compiled.lookup(0xFFFFFF).empty();
+
+    // Truncated files and files that are not databases or text registries are rejected
+    std::ifstream in(database, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    writeFile(damaged, bytes.substr(0, bytes.size() - 1));
+    bool truncated = rejects(damaged);
+    writeFile(damaged, "not a registry\n");
+    bool garbage = rejects(damaged);
+    ok = ok && truncated && garbage && rejects(tempPath("missing.db"));
+
+    std::remove(text.c_str());
+    std::remove(database.c_str());
+    std::remove(damaged.c_str());
+
+    if (ok) {
+        std::cout << "✓ Compiled 35k-entry databases map and resolve every OUI - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Compiled 35k-entry databases map and resolve every OUI - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+int main() {
+    std::cout << "Starting OUI Registry Tests..." << std::endl;
+
+    try {
+        testBuiltinTable();
+        testRegistryFormats();
+        testCompiledDatabase();
+
+        std::cout << "\n🎉 All tests passed! Vendors resolve from the OUI registry." << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,124 @@
+#include "platforms/ScanBackends.h"
+#include "platforms/LinuxWifiScanner.h"
+#include <iostream>
+#include <cassert>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace WifiScanner;
+
+void testProbesOnceOnFirstUse() {
+    int probes = 0;
+    std::set<ScanBackend> present = {ScanBackend::IW, ScanBackend::PROC_NET};
+    ScanBackendRegistry registry([&](ScanBackend backend) {
+        ++probes;
+        return present.count(backend) > 0;
+    });
+
+    LinuxWifiScanner scanner(registry);
+    bool ok = probes == 0;  // Constructing a scanner probes nothing
+
+    for (int i = 0; i < 5; ++i) {
+        ok = ok && scanner.isSupported();
+    }
+    ok = ok && probes == 4 && registry.best() == ScanBackend::IW &&
+         registry.available() == std::vector<ScanBackend>{ScanBackend::IW, ScanBackend::PROC_NET} &&
+         registry.isAvailable(ScanBackend::PROC_NET) && !registry.isAvailable(ScanBackend::NL80211) &&
+         probes == 4;
+
+    // A newly installed tool only shows up after a refresh
+    present.insert(ScanBackend::NETWORK_MANAGER);
+    ok = ok && registry.best() == ScanBackend::IW;
+    registry.refresh();
+    ok = ok && probes == 4 && registry.best() == ScanBackend::NETWORK_MANAGER && probes == 8;
+
+    if (ok) {
+        std::cout << "✓ Backends are probed once, lazily, and cached - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Backends are probed once, lazily, and cached - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testNoBackend() {
+    int probes = 0;
+    ScanBackendRegistry registry([&probes](ScanBackend) {
+        ++probes;
+        return false;
+    });
+    LinuxWifiScanner scanner(registry);
+
+    bool ok = !scanner.isSupported() && scanner.scan().empty() && !registry.best() && probes == 4;
+
+    if (ok) {
+        std::cout << "✓ Without a backend the scanner is unsupported and scans nothing - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Without a backend the scanner is unsupported and scans nothing - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testFailingBackendsFallThrough() {
+    // Claim every backend, whatever this machine really has: each one that
+    // cannot scan here must report nothing and hand over to the next
+    ScanBackendRegistry registry([](ScanBackend) { return true; });
+    LinuxWifiScanner scanner(registry);
+
+    bool ok = scanner.isSupported() && registry.available().size() == 4;
+    for (const ScanRequest& request : {ScanRequest::full(), ScanRequest::cached()}) {
+        for (const NetworkInfo& network : scanner.scan(request)) {
+            ok = ok && !network.bssid.empty();
+        }
+    }
+
+    if (ok) {
+        std::cout << "✓ Backends that fail at scan time fall through to the next - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Backends that fail at scan time fall through to the next - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testSystemProbe() {
+    // Whatever this machine has, the real probes must answer without throwing
+    // and agree with the process-wide registry
+    std::vector<ScanBackend> expected;
+    for (ScanBackend backend : {ScanBackend::NL80211, ScanBackend::NETWORK_MANAGER, ScanBackend::IW,
+                                ScanBackend::PROC_NET}) {
+        if (ScanBackendRegistry::probeSystem(backend)) {
+            expected.push_back(backend);
+        }
+    }
+
+    bool ok = ScanBackendRegistry::instance().available() == expected &&
+              std::string(ScanBackendRegistry::name(ScanBackend::NETWORK_MANAGER)) == "NetworkManager";
+
+    if (ok) {
+        std::cout << "✓ System probes match the shared registry - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ System probes match the shared registry - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+int main() {
+    std::cout << "Starting Scan Backend Tests..." << std::endl;
+
+    try {
+        testProbesOnceOnFirstUse();
+        testNoBackend();
+        testFailingBackendsFallThrough();
+        testSystemProbe();
+
+        std::cout << "\n🎉 All tests passed! Backends are probed once and cached." << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,265 @@
+#include "platforms/LinuxWifiScanner.h"
+#include "ScanRequest.h"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+
+using namespace WifiScanner;
+
+// Abridged `iw dev wlan0 scan` output, element blocks included: WPA2 on HT40,
+// a hidden WPA3 VHT160 network, an open 5 GHz network with CRLF line endings
+// and a 6 GHz HE enterprise network
+const std::string IW_OUTPUT =
+    "BSS 00:1c:c0:12:34:56(on wlan0) -- associated\n"
+    "\tlast seen: 1234.567s [boottime]\n"
+    "\tTSF: 1234567 usec (0d, 00:00:01)\n"
+    "\tfreq: 2437.0\n"
+    "\tbeacon interval: 100 TUs\n"
+    "\tcapability: ESS Privacy ShortSlotTime (0x0411)\n"
+    "\tsignal: -45.00 dBm\n"
+    "\tSSID: Home Net\n"
+    "\tSupported rates: 1.0* 2.0* 5.5* 11.0* 6.0 9.0 12.0 18.0 \n"
+    "\tDS Parameter set: channel 6\n"
+    "\tExtended supported rates: 24.0 36.0 48.0 54.0 \n"
+    "\tRSN:\t * Version: 1\n"
+    "\t\t * Group cipher: CCMP\n"
+    "\t\t * Pairwise ciphers: CCMP\n"
+    "\t\t * Authentication suites: PSK\n"
+    "\t\t * Capabilities: 1-PTKSA-RC 1-GTKSA-RC (0x0000)\n"
+    "\tBSS Load:\n"
+    "\t\t * station count: 3\n"
+    "\tHT capabilities:\n"
+    "\t\tCapabilities: 0x1ef\n"
+    "\t\t\tHT20/HT40\n"
+    "\t\tHT RX MCS rate indexes supported: 0-15\n"
+    "\t\tHT TX MCS rate indexes are undefined\n"
+    "\tHT operation:\n"
+    "\t\t * primary channel: 6\n"
+    "\t\t * secondary channel offset: below\n"
+    "\t\t * STA channel width: any\n"
+    "\tWPS:\t * Version: 1.0\n"
+    "\t\t * Wi-Fi Protected Setup State: 2 (Configured)\n"
+    "BSS 02:aa:bb:cc:dd:ee(on wlan0)\n"
+    "\tfreq: 5180\n"
+    "\tbeacon interval: 102 TUs\n"
+    "\tcapability: ESS Privacy SpectrumMgmt (0x0111)\n"
+    "\tsignal: -70.00 dBm\n"
+    "\tSSID: \\x00\\x00\\x00\n"
+    "\tSupported rates: 6.0* 9.0 12.0* 18.0 24.0* 36.0 48.0 54.0 \n"
+    "\tRSN:\t * Version: 1\n"
+    "\t\t * Group cipher: CCMP\n"
+    "\t\t * Pairwise ciphers: CCMP\n"
+    "\t\t * Authentication suites: PSK SAE\n"
+    "\t\t * Capabilities: 16-PTKSA-RC 1-GTKSA-RC MFP-capable (0x008c)\n"
+    "\tHT capabilities:\n"
+    "\t\tHT TX/RX MCS rate indexes supported: 0-23\n"
+    "\tHT operation:\n"
+    "\t\t * STA channel width: any\n"
+    "\tVHT capabilities:\n"
+    "\t\tVHT Capabilities (0x0f8b69b2):\n"
+    "\t\t\tMax MPDU length: 11454\n"
+    "\t\tVHT RX MCS set:\n"
+    "\t\t\t1 streams: MCS 0-9\n"
+    "\t\t\t2 streams: MCS 0-9\n"
+    "\t\t\t3 streams: MCS 0-9\n"
+    "\t\t\t4 streams: not supported\n"
+    "\t\tVHT RX highest supported: 0 Mbps\n"
+    "\t\tVHT TX MCS set:\n"
+    "\t\t\t1 streams: MCS 0-9\n"
+    "\t\t\t2 streams: MCS 0-9\n"
+    "\t\t\t3 streams: MCS 0-9\n"
+    "\t\t\t4 streams: MCS 0-9\n"
+    "\tVHT operation:\n"
+    "\t\t * channel width: 1 (80 MHz)\n"
+    "\t\t * center freq segment 1: 42\n"
+    "\t\t * center freq segment 2: 50\n"
+    "BSS 00:1b:63:01:02:03(on wlan0)\r\n"
+    "\tfreq: 5745\r\n"
+    "\tcapability: ESS (0x0001)\r\n"
+    "\tsignal: -81.50 dBm\r\n"
+    "\tSSID: Airport Free WiFi\r\n"
+    "\tSupported rates: 6.0* 9.0 12.0* 18.0 24.0* 36.0 48.0 54.0 \r\n"
+    "BSS 0a:0b:0c:0d:0e:0f(on wlan0)\n"
+    "\tfreq: 5955\n"
+    "\tcapability: ESS Privacy (0x0011)\n"
+    "\tsignal: -52.00 dBm\n"
+    "\tSSID: \\x20Corp\n"
+    "\tRSN:\t * Version: 1\n"
+    "\t\t * Group cipher: GCMP-256\n"
+    "\t\t * Pairwise ciphers: GCMP-256\n"
+    "\t\t * Authentication suites: IEEE 802.1X/SUITE-B-192\n"
+    "\t\t * Capabilities: 1-PTKSA-RC 1-GTKSA-RC MFP-required MFP-capable (0x00c0)\n"
+    "\tHE capabilities:\n"
+    "\t\tHE MAC Capabilities (0x000000000000):\n"
+    "\t\tHE RX MCS and NSS set <= 80 MHz\n"
+    "\t\t\t1 streams: MCS 0-11\n"
+    "\t\t\t2 streams: MCS 0-11\n"
+    "\t\t\t3 streams: not supported\n"
+    "\t\tHE TX MCS and NSS set <= 80 MHz\n"
+    "\t\t\t1 streams: MCS 0-11\n"
+    "\tHE Operation:\n"
+    "\t\tHE Operation Parameters: (0x020000)\n"
+    "\t\t6 GHz Operation Information\n"
+    "\t\t\tPrimary Channel: 1\n"
+    "\t\t\tChannel Width: 2\n";
+
+void testIwOutput() {
+    LinuxWifiScanner scanner;
+    auto networks = scanner.parseIwScanOutput(IW_OUTPUT);
+
+    size_t streamed = scanner.parseIwScanOutput(IW_OUTPUT, [](const NetworkInfo&) {});
+
+    bool ok = networks.size() == 4 && streamed == 4;
+    if (ok) {
+        const NetworkInfo& home = networks[0];
+        ok = home.bssid == "00:1C:C0:12:34:56" && home.ssid == "Home Net" && home.frequency == 2437 &&
+             home.channel == 6 && home.signalStrength == -45 && home.beaconInterval == 100 &&
+             home.securityType == SecurityType::WPA2_PERSONAL && home.channelWidth == 40 &&
+             home.maxDataRate == 300 && home.supportsWPS && !home.supportsPMF && !home.isGuestNetwork &&
+             home.vendor == "Cisco" && home.capabilities == "[WPA2-PSK-CCMP][WPS][ESS]";
+
+        const NetworkInfo& hidden = networks[1];
+        ok = ok && hidden.isHidden && hidden.ssid.empty() && hidden.channel == 36 &&
+             hidden.beaconInterval == 102 && hidden.securityType == SecurityType::WPA3_PERSONAL &&
+             hidden.supportsPMF && !hidden.supportsWPS && hidden.channelWidth == 160 &&
+             hidden.maxDataRate == 2601 && hidden.capabilities == "[WPA2-PSK+SAE-CCMP][PMF][ESS]";
+
+        const NetworkInfo& airport = networks[2];
+        ok = ok && airport.bssid == "00:1B:63:01:02:03" && airport.ssid == "Airport Free WiFi" &&
+             airport.frequency == 5745 && airport.channel == 149 && airport.signalStrength == -81 &&
+             airport.securityType == SecurityType::OPEN && airport.channelWidth == 20 &&
+             airport.maxDataRate == 54 && airport.isGuestNetwork && airport.vendor == "Apple";
+
+        const NetworkInfo& corp = networks[3];
+        ok = ok && corp.ssid == " Corp" && corp.channel == 1 &&
+             corp.securityType == SecurityType::WPA3_ENTERPRISE && corp.isEnterprise &&
+             corp.channelWidth == 80 && corp.maxDataRate == 1202 &&
+             corp.capabilities == "[WPA2-EAP-SUITE-B-192-GCMP-256][PMF-REQUIRED][ESS]";
+    }
+
+    if (ok && scanner.parseIwScanOutput("").empty() && scanner.parseIwScanOutput("\tSSID: orphan\n").empty()) {
+        std::cout << "✓ Full iw scan output parses in one pass - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Full iw scan output parses in one pass - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testMergeRadioScans() {
+    // The 2.4 GHz radio hears the first two BSSes; the 5 GHz radio hears all four, the first more weakly
+    LinuxWifiScanner scanner;
+    std::vector<std::vector<NetworkInfo>> perRadio = {scanner.parseIwScanOutput(IW_OUTPUT),
+                                                      scanner.parseIwScanOutput(IW_OUTPUT)};
+    perRadio[0].resize(2);
+    for (auto& network : perRadio[0]) {
+        network.radios = "wlan0";
+    }
+    for (auto& network : perRadio[1]) {
+        network.radios = "wlan1";
+    }
+    perRadio[1][0].signalStrength = -60;
+    perRadio[1][1].signalStrength = -50;
+
+    auto merged = LinuxWifiScanner::mergeRadioScans(perRadio);
+
+    bool ok = merged.size() == 4 &&
+              merged[0].bssid == "00:1C:C0:12:34:56" && merged[0].signalStrength == -45 &&
+              merged[0].radios == "wlan0,wlan1" &&
+              merged[1].signalStrength == -50 && merged[1].radios == "wlan0,wlan1" && merged[1].isHidden &&
+              merged[2].radios == "wlan1" && merged[3].radios == "wlan1";
+
+    if (ok) {
+        std::cout << "✓ Radio scans merge by BSSID, keeping the strongest - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Radio scans merge by BSSID, keeping the strongest - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testNmcliOutput() {
+    // nmcli -t escapes the colons inside fields
+    const std::string output =
+        "Office:00\\:1C\\:C0\\:AA\\:BB\\:CC:6:2437 MHz:130 Mbit/s:72:WPA2\n"
+        "\n"
+        "Lab\\:5G:02\\:00\\:00\\:00\\:00\\:01:36:5180 MHz:540 Mbit/s:55:WPA3 802.1X enterprise\n"
+        "Cafe:02\\:00\\:00\\:00\\:00\\:02:11:2462 MHz::40:\n"
+        "truncated:line\n";
+
+    LinuxWifiScanner scanner;
+    auto networks = scanner.parseNmcliOutput(output);
+
+    bool ok = networks.size() == 3;
+    if (ok) {
+        ok = networks[0].ssid == "Office" && networks[0].bssid == "00:1C:C0:AA:BB:CC" &&
+             networks[0].channel == 6 && networks[0].frequency == 2437 && networks[0].maxDataRate == 130 &&
+             networks[0].signalStrength == 72 && networks[0].securityType == SecurityType::WPA2_PERSONAL &&
+             networks[0].vendor == "Cisco" &&
+             networks[1].ssid == "Lab:5G" && networks[1].channel == 36 && networks[1].maxDataRate == 540 &&
+             networks[1].securityType == SecurityType::WPA3_ENTERPRISE && networks[1].isEnterprise &&
+             networks[2].ssid == "Cafe" && networks[2].maxDataRate == 0 &&
+             networks[2].securityType == SecurityType::UNKNOWN && networks[2].isGuestNetwork;
+    }
+
+    if (ok) {
+        std::cout << "✓ nmcli terse output parses with escaped colons - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ nmcli terse output parses with escaped colons - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testNmcliFrequencies() {
+    // 6 GHz reuses channel numbers, so FREQ decides the band; older recordings
+    // without FREQ still parse, with 2.4 and 5 GHz channels (UNII-4 included)
+    const std::string output =
+        "Six:02\\:00\\:00\\:00\\:00\\:03:5:5975 MHz:1200 Mbit/s:60:WPA3\n"
+        "Unii4:02\\:00\\:00\\:00\\:00\\:04:173:5865 MHz:866 Mbit/s:50:WPA2\n"
+        "Legacy:02\\:00\\:00\\:00\\:00\\:05:177:866 Mbit/s:45:WPA2\n";
+
+    LinuxWifiScanner scanner;
+    auto networks = scanner.parseNmcliOutput(output);
+
+    bool ok = networks.size() == 3 &&
+              networks[0].channel == 5 && networks[0].frequency == 5975 && networks[0].maxDataRate == 1200 &&
+              networks[0].signalStrength == 60 && networks[0].securityType == SecurityType::WPA3_PERSONAL &&
+              networks[1].channel == 173 && networks[1].frequency == 5865 &&
+              networks[2].channel == 177 && networks[2].frequency == 5885 && networks[2].maxDataRate == 866 &&
+              networks[2].signalStrength == 45 && networks[2].securityType == SecurityType::WPA2_PERSONAL;
+
+    // Band and channel targets match them instead of dropping every nmcli result
+    if (ok) {
+        const ScanRequest sixGhz = ScanRequest::band(WifiBand::BAND_6GHZ);
+        const ScanRequest unii4 = ScanRequest::channels({173, 177});
+        ok = sixGhz.includes(networks[0].frequency) && !sixGhz.includes(networks[1].frequency) &&
+             unii4.includes(networks[1].frequency) && unii4.includes(networks[2].frequency);
+    }
+
+    if (ok) {
+        std::cout << "✓ nmcli frequencies place 6 GHz and UNII-4 channels - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ nmcli frequencies place 6 GHz and UNII-4 channels - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+int main() {
+    std::cout << "Starting Scan Parser Tests..." << std::endl;
+
+    try {
+        testIwOutput();
+        testMergeRadioScans();
+        testNmcliOutput();
+        testNmcliFrequencies();
+
+        std::cout << "\n🎉 All tests passed! Scan output parses as expected." << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
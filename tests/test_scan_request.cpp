@@ -0,0 +1,105 @@
+#include "ScanRequest.h"
+#include "NetworkTable.h"
+#include "WifiScanner.h"
+#include <iostream>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace WifiScanner;
+
+// A backend that can only do full scans, so it relies on the default scan(request)
+class FixedScanner : public WifiScanner::WifiScanner {
+public:
+    using WifiScanner::scan;
+
+    std::vector<NetworkInfo> scan() override {
+        std::vector<NetworkInfo> networks;
+        for (int frequency : {2412, 2437, 5180, 5955}) {
+            NetworkInfo network;
+            network.ssid = "net-" + std::to_string(frequency);
+            network.frequency = frequency;
+            networks.push_back(network);
+        }
+        ++scans;
+        return networks;
+    }
+
+    bool isSupported() const override { return true; }
+    std::string getPlatformName() const override { return "Fixed"; }
+
+    int scans = 0;
+};
+
+void testRequests() {
+    const ScanRequest cached = ScanRequest::cached();
+    const ScanRequest full = ScanRequest::full();
+    const ScanRequest low = ScanRequest::band(WifiBand::BAND_2_4GHZ);
+    const ScanRequest high = ScanRequest::band(WifiBand::BAND_5GHZ);
+    const ScanRequest six = ScanRequest::band(WifiBand::BAND_6GHZ);
+    const ScanRequest hot = ScanRequest::channels({1, 6, 11, 36, 6, 5975});
+
+    bool ok = cached.mode == ScanMode::CACHED && !cached.isTargeted() && cached.includes(5180) &&
+              full.mode == ScanMode::ACTIVE && !full.isTargeted() &&
+              low.frequencies.size() == 14 && low.includes(2484) && !low.includes(5180) &&
+              high.frequencies.size() == 28 && high.includes(5180) && high.includes(5885) && !high.includes(5340) &&
+              six.frequencies.size() == 59 && six.includes(5955) && six.includes(7115) &&
+              hot.frequencies == std::vector<int>{2412, 2437, 2462, 5180, 5975} && !hot.includes(2417) &&
+              cached.describe() == "cached" && full.describe() == "full" && hot.describe() == "active, 5 channels";
+
+    bool rejected = false;
+    try {
+        ScanRequest::channels({15});
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+
+    if (ok && rejected) {
+        std::cout << "✓ Scan requests cover the requested bands and channels - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Scan requests cover the requested bands and channels - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testDefaultScanFiltersChannels() {
+    FixedScanner scanner;
+    ::WifiScanner::WifiScanner& base = scanner;
+
+    auto all = base.scan(ScanRequest::full());
+    auto high = base.scan(ScanRequest::band(WifiBand::BAND_5GHZ));
+    auto hot = base.scan(ScanRequest::channels({6}));
+    NetworkTable table;
+    base.scanInto(table, ScanRequest::band(WifiBand::BAND_6GHZ));
+
+    bool ok = all.size() == 4 && high.size() == 1 && high[0].frequency == 5180 &&
+              hot.size() == 1 && hot[0].ssid == "net-2437" &&
+              table.size() == 1 && table[0].frequency() == 5955 && scanner.scans == 4;
+
+    if (ok) {
+        std::cout << "✓ Backends without targeted scans return only the requested channels - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Backends without targeted scans return only the requested channels - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+int main() {
+    std::cout << "Starting Scan Request Tests..." << std::endl;
+
+    try {
+        testRequests();
+        testDefaultScanFiltersChannels();
+
+        std::cout << "\n🎉 All tests passed! Scan requests select what to sweep." << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
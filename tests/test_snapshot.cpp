@@ -0,0 +1,263 @@
+#include "NetworkSnapshot.h"
+#include "SecurityGrader.h"
+#include "TestNetworks.h"
+#include "VendorRegistry.h"
+#include <iostream>
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace WifiScanner;
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("wifi_snapshot_test_" + name)).string();
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string& path, const std::string& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+bool rejects(const std::string& path) {
+    try {
+        SnapshotTable snapshot(path);
+        return false;
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+}
+
+void testRoundTrip() {
+    auto networks = randomNetworks(2500, 4);
+    networks[0].ssid = std::string("Hidden\0Net", 10);  // SSIDs are raw bytes
+    networks[1].ssid = "";
+    networks[2].vendor = "Ubiquiti";
+    networks[2].vendorId = VendorRegistry::instance().intern(networks[2].vendor);
+    NetworkTable table(networks);
+    const std::string path = tempPath("roundtrip.snap");
+    saveSnapshot(table, path);
+
+    bool ok;
+    {
+        SnapshotTable snapshot(path);
+        ok = snapshot.size() == networks.size() && snapshot.ssid(0).size() == 10 && snapshot.ssid(1).empty();
+        for (size_t i = 0; ok && i < networks.size(); ++i) {
+            ok = sameNetwork(snapshot.networkAt(i), networks[i]) && snapshot.ssid(i) == networks[i].ssid &&
+                 snapshot.vendorScores()[i] == table.vendorScores()[i] && snapshot.flags()[i] == table.flags()[i];
+        }
+
+        NetworkTable reloaded = snapshot.toNetworkTable();
+        ok = ok && reloaded.size() == table.size();
+        for (size_t i = 0; ok && i < table.size(); ++i) {
+            ok = sameNetwork(reloaded[i].toNetworkInfo(), networks[i]);
+        }
+    }
+
+    // An empty table is a valid snapshot too
+    const std::string emptyPath = tempPath("empty.snap");
+    saveSnapshot(NetworkTable(), emptyPath);
+    {
+        SnapshotTable empty(emptyPath);
+        ok = ok && empty.empty() && empty.toNetworkTable().empty();
+    }
+    std::remove(path.c_str());
+    std::remove(emptyPath.c_str());
+
+    if (ok) {
+        std::cout << "✓ Snapshot round trip preserves every column - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Snapshot round trip preserves every column - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testGradingFromMapping() {
+    auto networks = randomNetworks(3 * SecurityGrader::MIN_PARALLEL_CHUNK + 11, 6);
+    NetworkTable table(networks);
+    const std::string path = tempPath("grading.snap");
+    saveSnapshot(table, path);
+
+    SecurityGrader grader;
+    std::vector<int> mappedScores(networks.size()), tableScores(networks.size());
+    {
+        SnapshotTable snapshot(path);
+        grader.gradeBatch(snapshot.view(), mappedScores.data(), nullptr);
+    }
+    grader.gradeBatch(table.view(), tableScores.data(), nullptr);
+    std::remove(path.c_str());
+
+    if (mappedScores == tableScores) {
+        std::cout << "✓ Mapped snapshot scores like the table it came from - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Mapped snapshot scores like the table it came from - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testRejectsDamagedFiles() {
+    const std::string path = tempPath("source.snap");
+    const std::string damaged = tempPath("damaged.snap");
+    saveSnapshot(NetworkTable(randomNetworks(50, 8)), path);
+    const std::string good = readFile(path);
+
+    auto patched = [&good](size_t offset, const void* value, size_t size) {
+        std::string bytes = good;
+        std::memcpy(&bytes[offset], value, size);
+        return bytes;
+    };
+    SnapshotHeader header;
+    std::memcpy(&header, good.data(), sizeof(header));
+
+    bool ok = !rejects(path) && rejects(tempPath("missing.snap"));
+
+    writeFile(damaged, good.substr(0, good.size() - 1));
+    ok = ok && rejects(damaged);
+    writeFile(damaged, good.substr(0, 20));
+    ok = ok && rejects(damaged);
+    writeFile(damaged, patched(0, "NOTASNAP", 8));
+    ok = ok && rejects(damaged);
+
+    const uint32_t version = SnapshotTable::VERSION + 1;
+    writeFile(damaged, patched(offsetof(SnapshotHeader, version), &version, sizeof(version)));
+    ok = ok && rejects(damaged);
+
+    const uint32_t swapped = 0x04030201;
+    writeFile(damaged, patched(offsetof(SnapshotHeader, byteOrder), &swapped, sizeof(swapped)));
+    ok = ok && rejects(damaged);
+
+    const uint64_t rows = header.rowCount + 1;
+    writeFile(damaged, patched(offsetof(SnapshotHeader, rowCount), &rows, sizeof(rows)));
+    ok = ok && rejects(damaged);
+
+    // A column pointing past the end of the file
+    const uint64_t offset = good.size();
+    writeFile(damaged, patched(header.directoryOffset + offsetof(SnapshotColumnEntry, offset), &offset, sizeof(offset)));
+    ok = ok && rejects(damaged);
+
+    // An SSID reaching past the string heap
+    SnapshotColumnEntry ssidEntry;
+    std::memcpy(&ssidEntry, good.data() + header.directoryOffset, sizeof(ssidEntry));
+    const SnapshotString outside = {static_cast<uint32_t>(header.heapSize), 1};
+    writeFile(damaged, patched(ssidEntry.offset, &outside, sizeof(outside)));
+    ok = ok && ssidEntry.column == SnapshotColumn::SSID && rejects(damaged);
+
+    std::remove(path.c_str());
+    std::remove(damaged.c_str());
+
+    if (ok) {
+        std::cout << "✓ Missing, truncated and corrupt snapshots are rejected - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Missing, truncated and corrupt snapshots are rejected - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testLoadsWithoutRadios() {
+    // Snapshots written before the radios column was added load with no radios
+    const std::string path = tempPath("radios.snap");
+    const std::string older = tempPath("older.snap");
+    const std::vector<NetworkInfo> networks = randomNetworks(40, 12);
+    saveSnapshot(NetworkTable(networks), path);
+    std::string bytes = readFile(path);
+
+    SnapshotHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    bool found = false;
+    for (uint32_t i = 0; i < header.columnCount; ++i) {
+        const size_t entry = header.directoryOffset + i * sizeof(SnapshotColumnEntry);
+        SnapshotColumn column;
+        std::memcpy(&column, bytes.data() + entry, sizeof(column));
+        if (column == SnapshotColumn::RADIOS) {
+            const uint32_t unknown = 99;  // Skipped like any column from a later version
+            std::memcpy(&bytes[entry], &unknown, sizeof(unknown));
+            found = true;
+        }
+    }
+    writeFile(older, bytes);
+
+    bool ok = found;
+    {
+        SnapshotTable snapshot(older);
+        for (size_t i = 0; ok && i < networks.size(); ++i) {
+            NetworkInfo expected = networks[i];
+            expected.radios.clear();
+            ok = snapshot.radios(i).empty() && sameNetwork(snapshot.networkAt(i), expected);
+        }
+    }
+    std::remove(path.c_str());
+    std::remove(older.c_str());
+
+    if (ok) {
+        std::cout << "✓ Snapshots without radios still load - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Snapshots without radios still load - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testVendorIdsReinternedOnLoad() {
+    // Vendor IDs depend on the order a process first saw each vendor, so a
+    // snapshot written by another process carries IDs that mean something else here
+    VendorRegistry& registry = VendorRegistry::instance();
+    const std::vector<std::string> vendors = {"Linksys", "TP-Link", "Ruckus Wireless", "Acme Radio"};
+    std::vector<NetworkInfo> networks = randomNetworks(vendors.size(), 10);
+    for (size_t i = 0; i < vendors.size(); ++i) {
+        networks[i].vendor = vendors[i];
+        networks[i].vendorId = registry.intern(vendors[vendors.size() - 1 - i]);  // The other process's order
+    }
+    const std::string path = tempPath("vendors.snap");
+    saveSnapshot(NetworkTable(networks), path);
+
+    SecurityGrader grader;
+    bool ok = true;
+    {
+        SnapshotTable snapshot(path);
+        const NetworkTable reloaded = snapshot.toNetworkTable();
+        for (size_t i = 0; ok && i < vendors.size(); ++i) {
+            const NetworkInfo loaded = snapshot.networkAt(i);
+            ok = loaded.vendorId == registry.intern(vendors[i]) &&
+                 reloaded[i].vendorId() == loaded.vendorId &&
+                 grader.scoreBreakdown(loaded).vendor == SecurityGrader::vendorScore(vendors[i]) &&
+                 grader.scoreBreakdown(reloaded[i].toNetworkInfo()).vendor == SecurityGrader::vendorScore(vendors[i]);
+        }
+    }
+    std::remove(path.c_str());
+
+    if (ok) {
+        std::cout << "✓ Loaded vendors score by name, not by a saved ID - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Loaded vendors score by name, not by a saved ID - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+int main() {
+    std::cout << "Starting Snapshot Tests..." << std::endl;
+
+    try {
+        testRoundTrip();
+        testGradingFromMapping();
+        testRejectsDamagedFiles();
+        testLoadsWithoutRadios();
+        testVendorIdsReinternedOnLoad();
+
+        std::cout << "\n🎉 All tests passed! Snapshots reload exactly what was saved." << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
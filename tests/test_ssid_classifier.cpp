@@ -0,0 +1,239 @@
+#include "SsidClassifier.h"
+#include "NetworkTable.h"
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace WifiScanner;
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("wifi_ssid_test_" + name)).string();
+}
+
+void writeFile(const std::string& path, const std::string& contents) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << contents;
+}
+
+bool rejects(const std::string& path) {
+    try {
+        SsidClassifier::loadRules(path);
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+std::string lowered(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+// The classification a find() over every lower-cased pattern gives
+SsidClasses naiveClassify(const std::vector<SsidRule>& rules, const std::string& ssid) {
+    const std::string lowerSsid = lowered(ssid);
+    SsidClasses classes = 0;
+    for (const SsidRule& rule : rules) {
+        const std::string pattern = lowered(rule.pattern);
+        if (!pattern.empty() && lowerSsid.find(pattern) != std::string::npos) {
+            classes |= ssidClass(rule.category);
+        }
+    }
+    return classes;
+}
+
+void testDefaultGuestRules() {
+    SsidClassifier classifier;
+    const std::vector<SsidRule> rules = SsidClassifier::defaultRules();
+
+    bool ok = classifier.patternCount() == 17 &&
+              classifier.matches("Marriott_GUEST", SsidCategory::GUEST) &&
+              classifier.matches("xfinitywifi-Public", SsidCategory::GUEST) &&
+              classifier.matches("Contemporary", SsidCategory::GUEST) &&     // "temp" inside a word
+              classifier.matches("AirportFree", SsidCategory::GUEST) &&
+              !classifier.matches("HomeNetwork", SsidCategory::GUEST) &&
+              !classifier.matches("", SsidCategory::GUEST) &&
+              !classifier.matches("gues", SsidCategory::GUEST) &&
+              !classifier.matches("Guest", SsidCategory::WATCHLIST);
+
+    for (const char* ssid : {"CorpNet", "Visitor-5G", "Testing123", "MyCafe", "DEMO_AP", "Library",
+                             "opensesame", "free", "\xE2\x98\x95 Caf\xC3\xA9", "NETGEAR42", "eduroam"}) {
+        ok = ok && classifier.classify(ssid) == naiveClassify(rules, ssid);
+    }
+
+    if (ok) {
+        std::cout << "✓ Default rules keep the guest-network keywords - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Default rules keep the guest-network keywords - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testOverlappingPatterns() {
+    // Patterns that are suffixes and substrings of each other, across categories
+    const std::vector<SsidRule> rules = {
+        {SsidCategory::WATCHLIST, "he"},
+        {SsidCategory::CORPORATE, "she"},
+        {SsidCategory::HOTSPOT, "hers"},
+        {SsidCategory::GUEST, "his"},
+        {SsidCategory::CORPORATE, "ACME"},
+    };
+    SsidClassifier classifier(rules);
+
+    const SsidClasses she = ssidClass(SsidCategory::CORPORATE) | ssidClass(SsidCategory::WATCHLIST);
+    bool ok = classifier.classify("ushers") == (she | ssidClass(SsidCategory::HOTSPOT)) &&
+              classifier.classify("SHE") == she &&
+              classifier.classify("hi") == 0 &&
+              classifier.classify("ahishe") == (she | ssidClass(SsidCategory::GUEST)) &&
+              classifier.classify("acmecorp") == ssidClass(SsidCategory::CORPORATE) &&
+              classifier.classify("ACACME") == ssidClass(SsidCategory::CORPORATE) &&
+              classifier.patternCount() == 5;
+
+    if (ok) {
+        std::cout << "✓ Overlapping patterns report every category they end in - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Overlapping patterns report every category they end in - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testRulesFile() {
+    const std::string rules = tempPath("rules.txt");
+    const std::string bad = tempPath("bad.txt");
+
+    writeFile(rules,
+              "# Site ruleset\n"
+              "[corporate]\n"
+              "AcmeCorp\r\n"
+              "  acme-iot  \n"
+              "\n"
+              "[watchlist]\n"
+              "FreeAirportWiFi\n"
+              "[hotspot]\n"
+              "xfinitywifi\n"
+              "[guest]\n"
+              "lobby\n");
+    const std::vector<SsidRule> loaded = SsidClassifier::loadRules(rules);
+
+    std::vector<SsidRule> combined = SsidClassifier::defaultRules();
+    combined.insert(combined.end(), loaded.begin(), loaded.end());
+    SsidClassifier classifier(combined);
+
+    bool ok = loaded.size() == 5 && loaded[1].pattern == "acme-iot" &&
+              classifier.classify("ACMECORP-5G") == ssidClass(SsidCategory::CORPORATE) &&
+              classifier.classify("Acme-IoT") == ssidClass(SsidCategory::CORPORATE) &&
+              classifier.classify("FreeAirportWiFi") ==
+                  (ssidClass(SsidCategory::WATCHLIST) | ssidClass(SsidCategory::GUEST)) &&
+              classifier.classify("xfinitywifi") == ssidClass(SsidCategory::HOTSPOT) &&
+              classifier.matches("Lobby", SsidCategory::GUEST);
+
+    writeFile(bad, "[guest]\nlobby\n[sponsors]\nacme\n");
+    bool unknownSection = rejects(bad);
+    writeFile(bad, "acme\n[guest]\n");
+    bool noSection = rejects(bad);
+    ok = ok && unknownSection && noSection && rejects(tempPath("missing.txt"));
+
+    std::remove(rules.c_str());
+    std::remove(bad.c_str());
+
+    if (ok) {
+        std::cout << "✓ Rules files load by section and reject malformed input - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Rules files load by section and reject malformed input - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testLargeRuleset() {
+    // Thousands of patterns per category over a small alphabet, so they overlap heavily
+    std::mt19937 gen(11);
+    const std::string letters = "abcdeFGH-_ 0";
+    auto randomText = [&](size_t length) {
+        std::string text;
+        for (size_t i = 0; i < length; ++i) {
+            text += letters[gen() % letters.size()];
+        }
+        return text;
+    };
+
+    std::vector<SsidRule> rules;
+    for (int category = 0; category < 4; ++category) {
+        for (int i = 0; i < 2500; ++i) {
+            rules.push_back(SsidRule{static_cast<SsidCategory>(category), randomText(3 + gen() % 6)});
+        }
+    }
+    SsidClassifier classifier(rules);
+
+    bool ok = classifier.patternCount() == rules.size();
+    size_t matched = 0;
+    for (int i = 0; i < 2000 && ok; ++i) {
+        const std::string ssid = randomText(gen() % 33);
+        const SsidClasses classes = classifier.classify(ssid);
+        ok = classes == naiveClassify(rules, ssid);
+        matched += classes != 0;
+    }
+    ok = ok && matched > 0;
+
+    if (ok) {
+        std::cout << "✓ 10k-pattern automaton agrees with a naive search - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ 10k-pattern automaton agrees with a naive search - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+void testSweepClassification() {
+    std::vector<NetworkInfo> networks(4);
+    networks[0].ssid = "HotelGuest";
+    networks[1].ssid = "HomeNetwork";
+    networks[2].ssid = "";
+    networks[3].ssid = "AcmeCorp";
+
+    SsidClassifier classifier({{SsidCategory::GUEST, "guest"}, {SsidCategory::CORPORATE, "acme"}});
+    NetworkTable table;
+    table.append(networks);
+
+    const std::vector<SsidClasses> fromNetworks = classifier.classify(networks);
+    const std::vector<SsidClasses> fromTable = classifier.classify(table);
+    const std::vector<SsidClasses> expected = {ssidClass(SsidCategory::GUEST), 0, 0, ssidClass(SsidCategory::CORPORATE)};
+
+    bool ok = fromNetworks == expected && fromTable == expected;
+
+    if (ok) {
+        std::cout << "✓ Whole sweeps classify from networks and tables - PASSED" << std::endl;
+    } else {
+        std::cout << "✗ Whole sweeps classify from networks and tables - FAILED" << std::endl;
+        assert(false);
+    }
+}
+
+int main() {
+    std::cout << "Starting SSID Classifier Tests..." << std::endl;
+
+    try {
+        testDefaultGuestRules();
+        testOverlappingPatterns();
+        testRulesFile();
+        testLargeRuleset();
+        testSweepClassification();
+
+        std::cout << "\n🎉 All tests passed! SSIDs classify in one pass." << std::endl;
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}